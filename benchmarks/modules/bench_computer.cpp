@@ -0,0 +1,63 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_computer.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "faker/computer.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+
+static void BM_IpAddressIPv4(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(computer::ip_address()); }
+}
+BENCHMARK(BM_IpAddressIPv4);
+
+static void BM_IpAddressIPv6(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(computer::ip_address(IpAddressType::IPv6)); }
+}
+BENCHMARK(BM_IpAddressIPv6);
+
+static void BM_MacAddress(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(computer::mac_address()); }
+}
+BENCHMARK(BM_MacAddress);
+
+static void BM_IpAddressesCidr(benchmark::State& state) {
+    std::vector<char> buffer(16 * static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(computer::ip_addresses(
+            buffer, static_cast<std::size_t>(state.range(0)), "100.0.0.0/8", IpAddressOptions::ExcludeReserved
+        ));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IpAddressesCidr)->Arg(1024);
+
+static void BM_IpAddressesIPv6Compressed(benchmark::State& state) {
+    std::vector<char> buffer(40 * static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(computer::ip_addresses(
+            buffer, static_cast<std::size_t>(state.range(0)), IpAddressType::IPv6, IpAddressOptions::CompressIPv6
+        ));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IpAddressesIPv6Compressed)->Arg(1024);
+
+static void BM_MacAddresses(benchmark::State& state) {
+    std::vector<char> buffer(18 * static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(computer::mac_addresses(buffer, static_cast<std::size_t>(state.range(0))));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MacAddresses)->Arg(1024);
@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_datetime.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "faker/datetime.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+
+static void BM_Date(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(datetime::date()); }
+}
+BENCHMARK(BM_Date);
+
+static void BM_DateWeekday(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(datetime::date("1970-01-01", "2050-12-31", DaysOfWeek::Monday)); }
+}
+BENCHMARK(BM_DateWeekday);
+
+static void BM_Time(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(datetime::time()); }
+}
+BENCHMARK(BM_Time);
+
+static void BM_Datetime(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(datetime::datetime()); }
+}
+BENCHMARK(BM_Datetime);
+
+static void BM_DateRange(benchmark::State& state) {
+    const datetime::DateRange range;
+    for (auto _ : state) { benchmark::DoNotOptimize(datetime::date(range)); }
+}
+BENCHMARK(BM_DateRange);
+
+static void BM_DateRangeWeekday(benchmark::State& state) {
+    const datetime::DateRange range("1970-01-01", "2050-12-31", DaysOfWeek::Monday);
+    for (auto _ : state) { benchmark::DoNotOptimize(datetime::date(range)); }
+}
+BENCHMARK(BM_DateRangeWeekday);
+
+static void BM_TimeRange(benchmark::State& state) {
+    const datetime::TimeRange range;
+    for (auto _ : state) { benchmark::DoNotOptimize(datetime::time(range)); }
+}
+BENCHMARK(BM_TimeRange);
+
+static void BM_DatetimeRange(benchmark::State& state) {
+    const datetime::DateRange date_range;
+    const datetime::TimeRange time_range;
+    for (auto _ : state) { benchmark::DoNotOptimize(datetime::datetime(date_range, time_range)); }
+}
+BENCHMARK(BM_DatetimeRange);
+
+static void BM_DatetimePoint(benchmark::State& state) {
+    const datetime::DateRange date_range;
+    const datetime::TimeRange time_range;
+    for (auto _ : state) { benchmark::DoNotOptimize(datetime::datetime_point(date_range, time_range)); }
+}
+BENCHMARK(BM_DatetimePoint);
+
+static void BM_FillDatetimes(benchmark::State& state) {
+    const datetime::DateRange date_range;
+    const datetime::TimeRange time_range;
+    std::vector<std::int64_t> out(1 << 16);
+    for (auto _ : state) {
+        datetime::fill_datetimes(out, date_range, time_range);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(out.size()));
+}
+BENCHMARK(BM_FillDatetimes);
+
+static void BM_FillDatetimesNs(benchmark::State& state) {
+    const datetime::DateRange date_range("1970-01-01", "2050-12-31", DaysOfWeek::Monday | DaysOfWeek::Friday);
+    const datetime::TimeRange time_range;
+    std::vector<std::int64_t> out(1 << 16);
+    for (auto _ : state) {
+        datetime::fill_datetimes_ns(out, date_range, time_range);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(out.size()));
+}
+BENCHMARK(BM_FillDatetimesNs);
+
+// Argument: arrival process.
+static void BM_EventTimesNs(benchmark::State& state) {
+    datetime::EventTimeOptions options;
+    options.process = static_cast<ArrivalProcess>(state.range(0));
+    datetime::EventTimeSequence events(0, options);
+    std::vector<std::int64_t>   out(1 << 16);
+    for (auto _ : state) {
+        events.fill_ns(out);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(out.size()));
+}
+BENCHMARK(BM_EventTimesNs)
+    ->Arg(static_cast<int>(ArrivalProcess::Poisson))
+    ->Arg(static_cast<int>(ArrivalProcess::Diurnal))
+    ->Arg(static_cast<int>(ArrivalProcess::Bursty));
+
+static void BM_EventTimesIso(benchmark::State& state) {
+    datetime::EventTimeSequence events(0);
+    std::vector<char>           buffer(1 << 20);
+    std::int64_t                count = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(events.write_iso(buffer, buffer.size()));
+        benchmark::ClobberMemory();
+        count += static_cast<std::int64_t>(buffer.size() / 25);
+    }
+    state.SetItemsProcessed(count);
+}
+BENCHMARK(BM_EventTimesIso);
+
+// Each thread draws on its own engine and no timezone lock is taken, so on a machine with enough cores the items per
+// second should grow linearly with the threads.
+static void BM_DateThreads(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(datetime::date()); }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DateThreads)->ThreadRange(1, 64)->UseRealTime();
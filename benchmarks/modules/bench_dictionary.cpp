@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_dictionary.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "faker/dictionary.h"
+#include "faker/person.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+
+// The string path the token IDs replace.
+static void BM_LastNameStrings(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(person::last_name()); }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LastNameStrings);
+
+static void BM_LastNameTokenId(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(dictionary::token_id(DictionaryFields::LastName)); }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LastNameTokenId);
+
+static void BM_FillTokenIds(benchmark::State& state) {
+    std::vector<dictionary::TokenId> ids(1 << 16);
+    for (auto _ : state) {
+        dictionary::fill_token_ids(ids, DictionaryFields::LastName);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ids.size()));
+}
+BENCHMARK(BM_FillTokenIds);
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_location.cpp
+
+#include <benchmark/benchmark.h>
+
+#include "faker/location.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+
+// Argument: region.
+static void BM_City(benchmark::State& state) {
+    const auto region = static_cast<Regions>(state.range(0));
+    for (auto _ : state) { benchmark::DoNotOptimize(location::city(region)); }
+}
+BENCHMARK(BM_City)->Arg(static_cast<int>(Regions::UnitedStates))->Arg(static_cast<int>(Regions::China));
+
+static void BM_Postcode(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(location::postcode()); }
+}
+BENCHMARK(BM_Postcode);
+
+static void BM_FullAddress(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(location::full_address(Regions::China)); }
+}
+BENCHMARK(BM_FullAddress);
+
+static void BM_LocationReroll(benchmark::State& state) {
+    location::Location location;
+    for (auto _ : state) {
+        location.reroll();
+        benchmark::DoNotOptimize(location);
+    }
+}
+BENCHMARK(BM_LocationReroll);
+
+static void BM_LocationPostcode(benchmark::State& state) {
+    location::Location location;
+    for (auto _ : state) {
+        location.reroll();
+        benchmark::DoNotOptimize(location.postcode());
+    }
+}
+BENCHMARK(BM_LocationPostcode);
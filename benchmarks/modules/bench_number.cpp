@@ -0,0 +1,130 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_number.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "faker/number.h"
+
+using namespace ::faker;
+
+static void BM_Decimal(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(number::decimal(-50.0, 50.0, 3)); }
+}
+BENCHMARK(BM_Decimal);
+
+static void BM_DecimalString(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(number::decimal_string(-100.0, 100.0, 6)); }
+}
+BENCHMARK(BM_DecimalString);
+
+static void BM_IntegerLoop(benchmark::State& state) {
+    std::vector<int32_t> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (int32_t& value : values) { value = number::integer(-1000, 1000); }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IntegerLoop)->Arg(65536);
+
+static void BM_FillIntegers(benchmark::State& state) {
+    std::vector<int32_t> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        number::fill_integers(std::span(values), -1000, 1000);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillIntegers)->Arg(65536);
+
+static void BM_FillIntegersWide(benchmark::State& state) {
+    std::vector<int64_t> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        number::fill_integers(std::span(values), int64_t{-1000000000000000000}, int64_t{1000000000000000000});
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillIntegersWide)->Arg(65536);
+
+static void BM_FillDecimals(benchmark::State& state) {
+    std::vector<double> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        number::fill_decimals(std::span(values), 0.0, 500.0);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillDecimals)->Arg(65536);
+
+static void BM_FillReals(benchmark::State& state) {
+    std::vector<double> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        number::fill_reals(std::span(values), 0.0, 1.0);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillReals)->Arg(65536);
+
+static void BM_Normal(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(number::normal(170.0, 10.0)); }
+}
+BENCHMARK(BM_Normal);
+
+static void BM_FillNormal(benchmark::State& state) {
+    std::vector<double> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        number::fill_normal(std::span(values), 170.0, 10.0);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillNormal)->Arg(65536);
+
+static void BM_FillLognormal(benchmark::State& state) {
+    std::vector<double> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        number::fill_lognormal(std::span(values), 3.0, 0.5);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillLognormal)->Arg(65536);
+
+static void BM_FillExponential(benchmark::State& state) {
+    std::vector<double> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        number::fill_exponential(std::span(values), 0.05);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillExponential)->Arg(65536);
+
+static void BM_FillPareto(benchmark::State& state) {
+    std::vector<double> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        number::fill_pareto(std::span(values), 1000.0, 1.16);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillPareto)->Arg(65536);
+
+static void BM_FillZipf(benchmark::State& state) {
+    std::vector<uint64_t> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        number::fill_zipf(std::span(values), 1000000, 1.1);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillZipf)->Arg(65536);
@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_payment.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "faker/payment.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+
+static void BM_CardNumber(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(payment::card_number()); }
+}
+BENCHMARK(BM_CardNumber);
+
+static void BM_CardNumberVisa(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(payment::card_number(CardTypes::Visa)); }
+}
+BENCHMARK(BM_CardNumberVisa);
+
+static void BM_CardDate(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(payment::card_date()); }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CardDate)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_ValidateCardNumbers(benchmark::State& state) {
+    const auto  count = static_cast<std::size_t>(state.range(0));
+    std::string records;
+    for (std::size_t i = 0; i < count; ++i) { records += payment::card_number() + '\n'; }
+    const auto results = std::make_unique<bool[]>(count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(payment::validate_card_numbers(records, {results.get(), count}));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValidateCardNumbers)->Arg(1 << 16);
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_person.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "faker/person.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+
+static void BM_Email(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(person::email()); }
+}
+BENCHMARK(BM_Email);
+
+static void BM_Emails(benchmark::State& state) {
+    std::vector<char> buffer(1 << 20);
+    std::int64_t      count = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(person::emails(buffer, 10000));
+        benchmark::ClobberMemory();
+        count += 10000;
+    }
+    state.SetItemsProcessed(count);
+}
+BENCHMARK(BM_Emails);
+
+// Argument: fields.
+static void BM_PersonReroll(benchmark::State& state) {
+    person::Person person(
+        Genders::M | Genders::F,
+        Languages::English,
+        Regions::UnitedStates,
+        "gmail.com,hotmail.com",
+        ',',
+        static_cast<PersonFields>(state.range(0))
+    );
+    for (auto _ : state) {
+        person.reroll();
+        benchmark::DoNotOptimize(person);
+    }
+}
+BENCHMARK(BM_PersonReroll)
+    ->Arg(static_cast<int>(PersonFields::All))
+    ->Arg(static_cast<int>(PersonFields::FullName | PersonFields::Gender | PersonFields::PhoneNumber))
+    ->Arg(static_cast<int>(PersonFields::Email));
@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_product.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "faker/product.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+
+static void BM_Barcode(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(product::barcode()); }
+}
+BENCHMARK(BM_Barcode);
+
+static void BM_Barcodes(benchmark::State& state) {
+    const auto        count = static_cast<std::size_t>(state.range(0));
+    std::vector<char> buffer(count * 14);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(product::barcodes(buffer, count, BarcodeTypes::EAN13));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Barcodes)->Arg(1024);
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_string.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "faker/string.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+
+static void BM_Uuid(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(string::uuid()); }
+}
+BENCHMARK(BM_Uuid);
+
+static void BM_UuidV7(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(string::uuid(true, UuidVersion::V7)); }
+}
+BENCHMARK(BM_UuidV7);
+
+static void BM_UuidBatch(benchmark::State& state) {
+    std::vector<char> buffer(37 * static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(string::uuid_batch(buffer, static_cast<std::size_t>(state.range(0))));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UuidBatch)->Arg(1024);
+
+static void BM_Text(benchmark::State& state) {
+    const auto size = static_cast<unsigned int>(state.range(0));
+    for (auto _ : state) { benchmark::DoNotOptimize(string::text(size, size)); }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Text)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void BM_TextView(benchmark::State& state) {
+    const auto size = static_cast<unsigned int>(state.range(0));
+    for (auto _ : state) { benchmark::DoNotOptimize(string::text_view(size, size)); }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TextView)->Arg(10000);
+
+static void BM_WriteText(benchmark::State& state) {
+    std::vector<char> buffer(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(string::write_text(buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WriteText)->Arg(4 << 20);
+
+static void BM_Words(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(string::words(static_cast<std::size_t>(state.range(0)))); }
+}
+BENCHMARK(BM_Words)->Arg(5);
+
+static void BM_Sentences(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(string::sentences(static_cast<std::size_t>(state.range(0)))); }
+}
+BENCHMARK(BM_Sentences)->Arg(3);
+
+static void BM_MarkovText(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(string::markov_text(static_cast<std::size_t>(state.range(0)))); }
+}
+BENCHMARK(BM_MarkovText)->Arg(100);
+
+// Argument: Markov order.
+static void BM_WriteMarkovText(benchmark::State& state) {
+    std::vector<char> buffer(4 << 20);
+    std::size_t       bytes = 0;
+    for (auto _ : state) {
+        bytes += string::write_markov_text(buffer, static_cast<unsigned int>(state.range(0)));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+BENCHMARK(BM_WriteMarkovText)->Arg(1)->Arg(2)->Arg(3);
@@ -0,0 +1,205 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_string_pool.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "faker/types/bilingual.h"
+#include "person_data.h"
+#include "string_pool.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace ::faker;
+using namespace ::faker::person;
+
+namespace {
+
+// Counts the L1 data cache read misses of the calling thread, where the kernel exposes the counter.
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attr{};
+        attr.size   = sizeof(attr);
+        attr.type   = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_L1D |
+            (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled       = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        fd_                 = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CacheMissCounter() {
+#if defined(__linux__)
+        if (fd_ >= 0) { close(fd_); }
+#endif
+    }
+
+    CacheMissCounter(const CacheMissCounter&)            = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+    [[nodiscard]] bool available() const {
+        return fd_ >= 0;
+    }
+
+    void start() const {
+#if defined(__linux__)
+        if (fd_ >= 0) { ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0); }
+#endif
+    }
+
+    void stop() const {
+#if defined(__linux__)
+        if (fd_ >= 0) { ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0); }
+#endif
+    }
+
+    [[nodiscard]] std::uint64_t count() const {
+        std::uint64_t value = 0;
+#if defined(__linux__)
+        if (fd_ >= 0 && read(fd_, &value, sizeof(value)) != sizeof(value)) { value = 0; }
+#endif
+        return value;
+    }
+
+private:
+    int fd_ = -1;
+};
+
+// The originals of a pool.
+struct PoolColumn {
+    const std::uint32_t* refs;
+    const char*          chars;
+    std::size_t          size;
+};
+
+template <std::size_t N, std::size_t OriginalBytes, std::size_t TranslationBytes, bool SharedTranslations>
+PoolColumn originals(const BilingualPool<N, OriginalBytes, TranslationBytes, SharedTranslations>& pool) {
+    return {pool.original_refs().data(), pool.original_chars(), N};
+}
+
+// The first and last name tables of every language, in both layouts.
+const std::array<std::span<const BilingualView>, 12> kViewTables = {
+    kEnglishMaleFirstNames,
+    kEnglishFemaleFirstNames,
+    kEnglishLastNames,
+    kSimplifiedChineseMaleFirstNames,
+    kSimplifiedChineseFemaleFirstNames,
+    kSimplifiedChineseLastNames,
+    kTraditionalChineseMaleFirstNames,
+    kTraditionalChineseFemaleFirstNames,
+    kTraditionalChineseLastNames,
+    kJapaneseMaleFirstNames,
+    kJapaneseFemaleFirstNames,
+    kJapaneseLastNames,
+};
+
+const std::array<PoolColumn, 12> kPoolTables = {
+    originals(kEnglishMaleFirstNamePool),
+    originals(kEnglishFemaleFirstNamePool),
+    originals(kEnglishLastNamePool),
+    originals(kSimplifiedChineseMaleFirstNamePool),
+    originals(kSimplifiedChineseFemaleFirstNamePool),
+    originals(kSimplifiedChineseLastNamePool),
+    originals(kTraditionalChineseMaleFirstNamePool),
+    originals(kTraditionalChineseFemaleFirstNamePool),
+    originals(kTraditionalChineseLastNamePool),
+    originals(kJapaneseMaleFirstNamePool),
+    originals(kJapaneseFemaleFirstNamePool),
+    originals(kJapaneseLastNamePool),
+};
+
+// Random (table, entry) pairs, the same for both layouts.
+struct Pick {
+    std::uint32_t table;
+    std::uint32_t entry;
+};
+
+std::vector<Pick> make_picks(const std::size_t count) {
+    std::mt19937_64   engine(42);
+    std::vector<Pick> picks(count);
+    for (Pick& pick : picks) {
+        pick.table = static_cast<std::uint32_t>(engine() % kViewTables.size());
+        pick.entry = static_cast<std::uint32_t>(engine() % kViewTables[pick.table].size());
+    }
+    return picks;
+}
+
+// Streams through a buffer larger than L2, so the next picks start from a cold L1 and L2, as they do when the picks
+// are interleaved with other work.
+void evict_caches() {
+    static std::vector<char> buffer(std::size_t{8} << 20);
+    for (std::size_t i = 0; i < buffer.size(); i += 64) { buffer[i] = static_cast<char>(buffer[i] + 1); }
+    benchmark::ClobberMemory();
+}
+
+std::string_view read(const std::span<const BilingualView> table, const std::uint32_t entry) {
+    return table[entry].original;
+}
+
+std::string_view read(const PoolColumn& table, const std::uint32_t entry) {
+    return pooled_string(table.chars, table.refs[entry]);
+}
+
+// Argument: whether the caches are evicted before every batch of picks.
+template <const auto& Tables>
+void pick_names(benchmark::State& state) {
+    constexpr std::size_t   kBatch = 256;
+    const bool              cold   = state.range(0) != 0;
+    const std::vector<Pick> picks  = make_picks(kBatch * 64);
+    CacheMissCounter        misses;
+    std::size_t             next  = 0;
+    std::size_t             count = 0;
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            evict_caches();
+            state.ResumeTiming();
+        }
+        misses.start();
+        for (std::size_t i = 0; i < kBatch; ++i, next = (next + 1) % picks.size()) {
+            const std::string_view name = read(Tables[picks[next].table], picks[next].entry);
+            benchmark::DoNotOptimize(name.front());
+        }
+        misses.stop();
+        count += kBatch;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(count));
+    if (misses.available()) {
+        state.counters["L1D misses/pick"] =
+            benchmark::Counter(static_cast<double>(misses.count()) / static_cast<double>(count));
+    }
+}
+
+}  // namespace
+
+static void BM_PickNameViews(benchmark::State& state) {
+    pick_names<kViewTables>(state);
+}
+BENCHMARK(BM_PickNameViews)->Arg(0);
+BENCHMARK(BM_PickNameViews)->Arg(1)->Iterations(1 << 12);
+
+static void BM_PickNamePool(benchmark::State& state) {
+    pick_names<kPoolTables>(state);
+}
+BENCHMARK(BM_PickNamePool)->Arg(0);
+BENCHMARK(BM_PickNamePool)->Arg(1)->Iterations(1 << 12);
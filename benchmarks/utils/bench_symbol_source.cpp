@@ -0,0 +1,34 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file bench_symbol_source.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+
+#include "faker/internal/symbol_source.h"
+
+using namespace ::faker;
+
+static void BM_DigitsUniformIntDistribution(benchmark::State& state) {
+    std::mt19937_64 engine(42);
+    for (auto _ : state) {
+        for (int i = 0; i < 16; ++i) {
+            std::uniform_int_distribution<std::size_t> distribution(0, 9);
+            benchmark::DoNotOptimize(distribution(engine));
+        }
+    }
+}
+BENCHMARK(BM_DigitsUniformIntDistribution);
+
+static void BM_DigitsSymbolSource(benchmark::State& state) {
+    std::mt19937_64 engine(42);
+    for (auto _ : state) {
+        SymbolSource source = make_symbol_source(10);
+        for (int i = 0; i < 16; ++i) { benchmark::DoNotOptimize(source(engine)); }
+    }
+}
+BENCHMARK(BM_DigitsSymbolSource);
@@ -7,7 +7,10 @@
 #ifndef FAKER_COMPUTER_H
 #define FAKER_COMPUTER_H
 
+#include <cstddef>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include "faker/internal/macros.h"
 #include "faker/types/enums.h"
@@ -16,20 +19,90 @@ namespace faker::computer {
 
 /// @brief Generates a random ip address.
 /// @param ip_address_type Ip address type. Defaults to IpAddressType::IPv4.
+/// @param options Ip address options. Defaults to IpAddressOptions::None.
+///                If multiple options are specified, bitwise(bitwise_or |) operator can be used.
 /// @return An ip address.
 /// @code
 /// faker::computer::ip_address();  // "43.186.254.66"
 /// faker::computer::ip_address(faker::IpAddressType::IPv6);  // "b7f5:713b:60bc:5df7:20cb:51a7:29e9:13e3"
+/// faker::computer::ip_address(faker::IpAddressType::IPv4, faker::IpAddressOptions::ExcludeReserved);  // "81.7.3.14"
 /// @endcode
-FAKER_EXPORT std::string ip_address(IpAddressType ip_address_type = IpAddressType::IPv4);
+FAKER_EXPORT std::string
+    ip_address(IpAddressType ip_address_type = IpAddressType::IPv4, IpAddressOptions options = IpAddressOptions::None);
+
+/// @brief Generates a random ip address within a CIDR block.
+/// @param cidr The CIDR block, e.g. "10.0.0.0/8" or "2001:db8::/32". Host bits are ignored.
+///             If invalid, or entirely reserved while IpAddressOptions::ExcludeReserved is set, throw error.
+/// @param options Ip address options. Defaults to IpAddressOptions::None.
+///                If multiple options are specified, bitwise(bitwise_or |) operator can be used.
+/// @return An ip address of the same type as the block.
+/// @code
+/// faker::computer::ip_address("192.168.0.0/16");  // "192.168.37.201"
+/// faker::computer::ip_address("2001:db8::/112", faker::IpAddressOptions::CompressIPv6);  // "2001:db8::6f3a"
+/// @endcode
+FAKER_EXPORT std::string ip_address(std::string_view cidr, IpAddressOptions options = IpAddressOptions::None);
+
+/// @brief Generates random ip addresses into a contiguous buffer.
+/// @param buffer The buffer to write to.
+/// @param count The number of ip addresses to write.
+///              Stops early at the last whole ip address that fits in the buffer.
+/// @param ip_address_type Ip address type. Defaults to IpAddressType::IPv4.
+/// @param options Ip address options. Defaults to IpAddressOptions::None.
+/// @param delimiter Written after each ip address. Defaults to '\n'.
+/// @return The number of bytes written.
+/// @code
+/// char buffer[16 * 1000];
+/// faker::computer::ip_addresses(buffer, 1000);  // "43.186.254.66\n8.8.4.4\n..."
+/// @endcode
+FAKER_EXPORT std::size_t ip_addresses(
+    std::span<char>  buffer,
+    std::size_t      count,
+    IpAddressType    ip_address_type = IpAddressType::IPv4,
+    IpAddressOptions options         = IpAddressOptions::None,
+    char             delimiter       = '\n'
+);
+
+/// @brief Generates random ip addresses within a CIDR block into a contiguous buffer.
+/// @param buffer The buffer to write to.
+/// @param count The number of ip addresses to write.
+///              Stops early at the last whole ip address that fits in the buffer.
+/// @param cidr The CIDR block, e.g. "10.0.0.0/8" or "2001:db8::/32". Host bits are ignored.
+///             If invalid, or entirely reserved while IpAddressOptions::ExcludeReserved is set, throw error.
+/// @param options Ip address options. Defaults to IpAddressOptions::None.
+/// @param delimiter Written after each ip address. Defaults to '\n'.
+/// @return The number of bytes written.
+/// @code
+/// char buffer[16 * 1000];
+/// faker::computer::ip_addresses(buffer, 1000, "10.0.0.0/8");  // "10.23.4.199\n10.201.0.7\n..."
+/// @endcode
+FAKER_EXPORT std::size_t ip_addresses(
+    std::span<char>  buffer,
+    std::size_t      count,
+    std::string_view cidr,
+    IpAddressOptions options   = IpAddressOptions::None,
+    char             delimiter = '\n'
+);
 
 /// @brief Generates a random mac address.
-/// @return A mac address.
+/// @return A locally administered unicast mac address.
 /// @code
 /// faker::computer::mac_address();  // "8e:6b:22:1a:7c:25"
 /// @endcode
 FAKER_EXPORT std::string mac_address();
 
+/// @brief Generates random mac addresses into a contiguous buffer.
+///        Every mac address is followed by the delimiter, so each one takes 18 bytes.
+/// @param buffer The buffer to write to.
+/// @param count The number of mac addresses to write.
+///              Stops early at the last whole mac address that fits in the buffer.
+/// @param delimiter Written after each mac address. Defaults to '\n'.
+/// @return The number of bytes written.
+/// @code
+/// char buffer[18 * 1000];
+/// faker::computer::mac_addresses(buffer, 1000);  // 18000, "8e:6b:22:1a:7c:25\n..."
+/// @endcode
+FAKER_EXPORT std::size_t mac_addresses(std::span<char> buffer, std::size_t count, char delimiter = '\n');
+
 /// @brief Generates a random file path.
 /// @param operating_systems Operating systems. Defaults to OperatingSystem::Windows.
 ///                          If multiple operating systems are specified, bitwise(bitwise_or |) operator can be used.
@@ -7,13 +7,213 @@
 #ifndef FAKER_DATETIME_H
 #define FAKER_DATETIME_H
 
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "faker/internal/macros.h"
 #include "faker/types/enums.h"
 
 namespace faker::datetime {
 
+class DateRange;
+class TimeRange;
+
+/// @brief Generates a random date string from a parsed date range.
+/// @param range The date range.
+/// @return A date string in the format of "%Y-%m-%d".
+FAKER_EXPORT std::string date(const DateRange& range);
+
+/// @brief Generates a random time string from a parsed time range.
+/// @param range The time range.
+/// @return A time string in the format of "%H:%M:%S".
+FAKER_EXPORT std::string time(const TimeRange& range);
+
+/// @brief Generates a random datetime string from parsed date and time ranges.
+/// @param date_range The date range.
+/// @param time_range The time range.
+/// @return A datetime string in the format of "%Y-%m-%d %H:%M:%S".
+FAKER_EXPORT std::string datetime(const DateRange& date_range, const TimeRange& time_range);
+
+/// @brief Generates a random date from a parsed date range, without formatting it.
+/// @param range The date range.
+/// @return Midnight UTC of the date.
+/// @code
+/// const faker::datetime::DateRange range("2023-01-01", "2023-12-31");
+/// faker::datetime::date_point(range).time_since_epoch().count();  // 19562, days since 1970-01-01
+/// @endcode
+FAKER_EXPORT std::chrono::sys_days date_point(const DateRange& range);
+
+/// @brief Generates a random time of day from a parsed time range, without formatting it.
+/// @param range The time range.
+/// @return Time since midnight.
+FAKER_EXPORT std::chrono::seconds time_of_day(const TimeRange& range);
+
+/// @brief Generates a random datetime from parsed date and time ranges, without formatting it.
+/// @param date_range The date range.
+/// @param time_range The time range.
+/// @return The UTC point in time.
+/// @code
+/// faker::datetime::datetime_point(date_range, time_range).time_since_epoch().count();  // 1681811112
+/// @endcode
+FAKER_EXPORT std::chrono::sys_seconds datetime_point(const DateRange& date_range, const TimeRange& time_range);
+
+/// @brief Generates a random datetime with a uniform fractional second from parsed date and time ranges.
+/// @param date_range The date range. Its days must be between 1677-09-22 and 2262-04-10, so that nanoseconds
+///                   fit in 64 bits. Otherwise, throw error.
+/// @param time_range The time range. The last second of the range is included as a whole.
+/// @return The UTC point in time.
+FAKER_EXPORT std::chrono::sys_time<std::chrono::nanoseconds>
+    datetime_point_ns(const DateRange& date_range, const TimeRange& time_range);
+
+/// @brief Fills a span with random dates, as seconds since the Unix epoch of their midnight UTC.
+///
+/// Equivalent to calling @code date_point()@endcode for every element, but several dates are drawn from each
+/// 64-bit random word.
+/// @param out The span to fill.
+/// @param range The date range.
+/// @code
+/// std::vector<std::int64_t> column(1'000'000);
+/// faker::datetime::fill_dates(std::span(column), faker::datetime::DateRange("2023-01-01", "2023-12-31"));
+/// @endcode
+FAKER_EXPORT void fill_dates(std::span<std::int64_t> out, const DateRange& range);
+
+/// @brief Fills a span with random times of day, as seconds since midnight.
+/// @param out The span to fill.
+/// @param range The time range.
+FAKER_EXPORT void fill_times(std::span<std::int64_t> out, const TimeRange& range);
+
+/// @brief Fills a span with random datetimes, as seconds since the Unix epoch.
+/// @param out The span to fill.
+/// @param date_range The date range.
+/// @param time_range The time range.
+FAKER_EXPORT void fill_datetimes(std::span<std::int64_t> out, const DateRange& date_range, const TimeRange& time_range);
+
+/// @brief Fills a span with random datetimes with a uniform fractional second, as nanoseconds since the Unix epoch.
+/// @param out The span to fill.
+/// @param date_range The date range. Its days must be between 1677-09-22 and 2262-04-10. Otherwise, throw error.
+/// @param time_range The time range.
+FAKER_EXPORT void
+    fill_datetimes_ns(std::span<std::int64_t> out, const DateRange& date_range, const TimeRange& time_range);
+
+/// @brief A date range parsed and validated once, to draw many dates from.
+/// @code
+/// const faker::datetime::DateRange range("2023-01-01", "2023-12-31", faker::DaysOfWeek::Monday);
+/// faker::datetime::date(range);  // "2023-07-24"
+/// @endcode
+class FAKER_EXPORT DateRange {
+public:
+    /// @brief Parses a date range.
+    /// @param start_date The start date string in the format of "%Y-%m-%d". Defaults to "1970-01-01".
+    ///                   If empty, throw error.
+    /// @param end_date The end date string in the format of "%Y-%m-%d". Defaults to "2050-12-31".
+    ///                 If empty, throw error.
+    /// @param days_of_week Days of the week. Defaults to DaysOfWeek::Sunday through DaysOfWeek::Saturday.
+    ///                     If multiple days are specified, bitwise(bitwise_or |) operator can be used.
+    ///                     If no day of the range is one of them, throw error.
+    explicit DateRange(
+        std::string_view start_date = "1970-01-01",
+        std::string_view end_date   = "2050-12-31",
+        DaysOfWeek days_of_week     = DaysOfWeek::Sunday |
+                                  DaysOfWeek::Monday |
+                                  DaysOfWeek::Tuesday |
+                                  DaysOfWeek::Wednesday |
+                                  DaysOfWeek::Thursday |
+                                  DaysOfWeek::Friday |
+                                  DaysOfWeek::Saturday
+    );
+
+    /// @brief Gets the number of days in the range, both ends included.
+    /// @return Number of days.
+    [[nodiscard]] std::int64_t day_count() const;
+
+    /// @brief Gets the number of days in the range that are allowed days of the week.
+    /// @return Number of allowed days.
+    [[nodiscard]] std::int64_t allowed_day_count() const;
+
+    /// @brief Gets the allowed days of the week.
+    /// @return Days of the week.
+    [[nodiscard]] DaysOfWeek days_of_week() const;
+
+private:
+    // Days since 1970-01-01 of the first day.
+    std::int64_t start_day_;
+    std::int64_t day_count_;
+    DaysOfWeek   days_of_week_;
+
+    // Allowed days are drawn by index: the k-th allowed day of week w is day `7 * w + allowed_offsets_[k]`.
+    std::array<std::uint8_t, 7> allowed_offsets_{};
+    unsigned                    allowed_per_week_  = 0;
+    std::int64_t                allowed_day_count_ = 0;
+
+    // Weekday of the day-th day of the range, 0 for Sunday.
+    [[nodiscard]] int weekday_of(std::int64_t day) const;
+
+    // The index-th allowed day, as days since 1970-01-01.
+    [[nodiscard]] std::int64_t day_at(std::int64_t index) const;
+
+    // Draws an allowed day, as days since 1970-01-01.
+    [[nodiscard]] std::int64_t random_day() const;
+
+    // Throws if nanoseconds since the Unix epoch of some day of the range do not fit in 64 bits.
+    void check_nanosecond_range() const;
+
+    friend std::string date(const DateRange& range);
+    friend std::string datetime(const DateRange& date_range, const TimeRange& time_range);
+    friend std::chrono::sys_days date_point(const DateRange& range);
+    friend std::chrono::sys_seconds datetime_point(const DateRange& date_range, const TimeRange& time_range);
+    friend std::chrono::sys_time<std::chrono::nanoseconds>
+        datetime_point_ns(const DateRange& date_range, const TimeRange& time_range);
+    friend void fill_dates(std::span<std::int64_t> out, const DateRange& range);
+    friend void fill_datetimes(std::span<std::int64_t> out, const DateRange& date_range, const TimeRange& time_range);
+    friend void
+        fill_datetimes_ns(std::span<std::int64_t> out, const DateRange& date_range, const TimeRange& time_range);
+};
+
+/// @brief A time of day range parsed and validated once, to draw many times from.
+/// @code
+/// const faker::datetime::TimeRange range("08:00:00", "17:00:00");
+/// faker::datetime::time(range);  // "12:19:28"
+/// @endcode
+class FAKER_EXPORT TimeRange {
+public:
+    /// @brief Parses a time range.
+    /// @param start_time The start time string in the format of "%H:%M:%S". Defaults to "00:00:00".
+    ///                   If empty, throw error.
+    /// @param end_time The end time string in the format of "%H:%M:%S". Defaults to "23:59:59".
+    ///                 If empty, throw error.
+    explicit TimeRange(std::string_view start_time = "00:00:00", std::string_view end_time = "23:59:59");
+
+    /// @brief Gets the number of seconds in the range, both ends included.
+    /// @return Number of seconds.
+    [[nodiscard]] int second_count() const;
+
+private:
+    // Seconds since midnight.
+    int start_second_;
+    int end_second_;
+
+    // Draws a time of day, as seconds since midnight.
+    [[nodiscard]] std::uint32_t random_second() const;
+
+    friend std::string time(const TimeRange& range);
+    friend std::string datetime(const DateRange& date_range, const TimeRange& time_range);
+    friend std::chrono::seconds time_of_day(const TimeRange& range);
+    friend std::chrono::sys_seconds datetime_point(const DateRange& date_range, const TimeRange& time_range);
+    friend std::chrono::sys_time<std::chrono::nanoseconds>
+        datetime_point_ns(const DateRange& date_range, const TimeRange& time_range);
+    friend void fill_times(std::span<std::int64_t> out, const TimeRange& range);
+    friend void fill_datetimes(std::span<std::int64_t> out, const DateRange& date_range, const TimeRange& time_range);
+    friend void
+        fill_datetimes_ns(std::span<std::int64_t> out, const DateRange& date_range, const TimeRange& time_range);
+};
+
 /// @brief Generates a random date string between start_date and end_date, filtering by specified days of the week.
 /// @param start_date The start date string in the format of "%Y-%m-%d". Defaults to "1970-01-01".
 ///                   If empty, throw error.
@@ -84,6 +284,132 @@ FAKER_EXPORT std::string datetime(
                               DaysOfWeek::Saturday
 );
 
+/// @brief Shape of an event time sequence.
+struct EventTimeOptions {
+    /// @brief Long-run mean number of events per second, greater than 0.
+    double events_per_second = 1000;
+    /// @brief Arrival process.
+    ArrivalProcess process = ArrivalProcess::Poisson;
+    /// @brief Diurnal: the rate swings between `1 - amplitude` and `1 + amplitude` times the mean, in `[0, 1]`.
+    double diurnal_amplitude = 0.5;
+    /// @brief Diurnal: UTC hour of the highest rate, in `[0, 24)`.
+    double diurnal_peak_hour = 14;
+    /// @brief Bursty: rate during a burst divided by the rate between bursts, at least 1.
+    double burst_factor = 20;
+    /// @brief Bursty: mean duration of a burst, in seconds, greater than 0.
+    double mean_burst_seconds = 1;
+    /// @brief Bursty: mean time between bursts, in seconds, greater than 0.
+    double mean_calm_seconds = 30;
+    /// @brief Length of a chunk, in nanoseconds, greater than 0. See @code EventTimeSequence@endcode.
+    std::int64_t chunk_nanoseconds = 1'000'000'000;
+};
+
+/// @brief A stream of non-decreasing event timestamps with realistic gaps, in O(1) per event.
+///
+/// The timeline is cut into chunks of `chunk_nanoseconds` from `start`. Each chunk runs the arrival process from its
+/// own engine, seeded from `seed` and the chunk index, so the events of a chunk do not depend on the chunks before
+/// it. A sequence started at chunk k yields exactly the events a sequence started at chunk 0 yields from chunk k on,
+/// which lets threads generate disjoint chunks of one series in parallel. Poisson and diurnal arrivals are memoryless,
+/// so restarting at a chunk boundary does not change their distribution. A bursty chunk starts in a burst with the
+/// long-run probability of being in one. The diurnal cycle is held constant over each 1/1024 of a day, at its mean
+/// over that slot, so an event costs the same at the trough as at the peak.
+/// @code
+/// faker::datetime::EventTimeSequence events(1'700'000'000'000'000'000);
+/// events.next_ns();  // 1700000000000734120
+/// events.next_iso();  // "2023-11-14T22:13:20.001Z"
+///
+/// // Thread k writes the events of chunk k.
+/// faker::datetime::EventTimeSequence chunk(start, options, seed, k);
+/// while (chunk.chunk() == k) { out.push_back(chunk.next_ns()); }
+/// @endcode
+class FAKER_EXPORT EventTimeSequence {
+public:
+    /// @brief Starts a sequence.
+    /// @param start_ns Start of chunk 0, in nanoseconds since the Unix epoch.
+    /// @param options Shape of the sequence. If a value is out of range, throw error.
+    /// @param seed Seed of the sequence. The events only depend on the options, the start and the seed.
+    /// @param first_chunk Index of the chunk to start at.
+    explicit EventTimeSequence(
+        std::int64_t     start_ns,
+        EventTimeOptions options     = {},
+        std::uint64_t    seed        = 0,
+        std::uint64_t    first_chunk = 0
+    );
+
+    /// @brief Gets the index of the chunk the next event is in.
+    /// @return The chunk index.
+    [[nodiscard]] std::uint64_t chunk() const;
+
+    /// @brief Gets the next event time.
+    /// @return Nanoseconds since the Unix epoch.
+    std::int64_t next_ns();
+
+    /// @brief Gets the next event time, rounded down to the millisecond.
+    /// @return Milliseconds since the Unix epoch.
+    std::int64_t next_ms();
+
+    /// @brief Gets the next event time as an ISO 8601 UTC string.
+    /// @param fraction_digits Digits of the fractional second, in `[0, 9]`. Defaults to 3.
+    /// @return A string in the format of "%Y-%m-%dT%H:%M:%S.fffZ".
+    std::string next_iso(unsigned int fraction_digits = 3);
+
+    /// @brief Fills a span with the next event times.
+    /// @param out The nanoseconds since the Unix epoch.
+    void fill_ns(std::span<std::int64_t> out);
+
+    /// @brief Fills a span with the next event times, rounded down to the millisecond.
+    /// @param out The milliseconds since the Unix epoch.
+    void fill_ms(std::span<std::int64_t> out);
+
+    /// @brief Writes the next event times as ISO 8601 UTC strings into a buffer.
+    ///
+    /// Each string is followed by the delimiter. Writing stops at the last whole string that fits, and the events
+    /// that are not written are not consumed.
+    /// @param buffer The buffer to write to.
+    /// @param count Maximum number of events to write.
+    /// @param fraction_digits Digits of the fractional second, in `[0, 9]`. Defaults to 3.
+    /// @param delimiter The delimiter written after each string. Defaults to '\n'.
+    /// @return The number of bytes written.
+    std::size_t write_iso(
+        std::span<char> buffer,
+        std::size_t     count,
+        unsigned int    fraction_digits = 3,
+        char            delimiter       = '\n'
+    );
+
+private:
+    // Constructor parameters.
+    EventTimeOptions options_;
+    std::int64_t     start_ns_;
+    std::uint64_t    seed_;
+
+    // Process constants, in nanoseconds.
+    double              mean_gap_ns_       = 0;
+    std::vector<double> slot_gap_ns_;  // Diurnal: mean gap in each slot of the day, from midnight UTC.
+    double              burst_gap_ns_      = 0;  // Bursty: mean gaps in and between bursts.
+    double              calm_gap_ns_       = 0;
+    double              burst_probability_ = 0;
+
+    // State of the current chunk, offsets are in nanoseconds from its start.
+    std::mt19937_64 engine_;
+    std::uint64_t   chunk_            = 0;
+    std::int64_t    chunk_start_ns_   = 0;
+    double          offset_ns_        = 0;
+    std::size_t     slot_             = 0;  // Diurnal: slot of the day the offset is in.
+    bool            in_burst_         = false;
+    double          switch_offset_ns_ = 0;  // Diurnal and bursty: offset of the next change of rate.
+    std::int64_t    pending_ns_       = 0;  // The next event, drawn ahead so that chunk() knows its chunk.
+
+    // Reseeds the engine and restarts the process at the start of a chunk.
+    void start_chunk(std::uint64_t index);
+
+    // Offset of the next arrival, at or past the chunk length when the chunk has no more.
+    double next_offset();
+
+    // Draws the next pending event, moving on through the chunks.
+    void advance();
+};
+
 }  // namespace faker::datetime
 
 #endif  // FAKER_DATETIME_H
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file dictionary.h
+
+#ifndef FAKER_DICTIONARY_H
+#define FAKER_DICTIONARY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "faker/internal/macros.h"
+#include "faker/types/enums.h"
+
+namespace faker::dictionary {
+
+/// @brief Index of a value in the dictionary of its field.
+using TokenId = std::uint16_t;
+
+/// @brief The values of a field picked from a data table, indexed by token ID.
+///        A dictionary views the static data tables, so it stays valid for the whole program.
+/// @code
+/// const auto colors = faker::dictionary::get(faker::DictionaryFields::Color);
+/// colors.size();  // 49
+/// colors[faker::dictionary::token_id(faker::DictionaryFields::Color)];  // "Sepia"
+/// @endcode
+class FAKER_EXPORT Dictionary {
+public:
+    /// @brief Constructs an empty dictionary.
+    Dictionary();
+
+    /// @brief Constructs a dictionary of values without translations.
+    /// @param values The values.
+    explicit Dictionary(std::span<const std::string_view> values);
+
+    /// @brief Get the number of values.
+    /// @return The number of values, every token ID is below it.
+    [[nodiscard]] std::size_t size() const;
+
+    /// @brief Get the value of a token ID.
+    /// @param token_id The token ID, below size().
+    /// @return The value in its original language.
+    [[nodiscard]] std::string_view operator[](TokenId token_id) const;
+
+    /// @brief Get the translation of the value of a token ID.
+    /// @param token_id The token ID, below size().
+    /// @return The translation, or the original if the values have no translations.
+    [[nodiscard]] std::string_view translation(TokenId token_id) const;
+
+private:
+    // Bilingual values kept in a string pool, whose layout is internal.
+    template <typename Pool>
+    friend Dictionary pooled_dictionary(const Pool& pool);
+
+    Dictionary(
+        std::span<const std::uint32_t> original_refs,
+        const char* original_chars,
+        std::span<const std::uint32_t> translation_refs,
+        const char* translation_chars
+    );
+
+    // Values without translations.
+    std::span<const std::string_view> values_;
+
+    // Bilingual values.
+    std::span<const std::uint32_t> original_refs_;
+    std::span<const std::uint32_t> translation_refs_;
+    const char*                    original_chars_    = nullptr;
+    const char*                    translation_chars_ = nullptr;
+};
+
+/// @brief Get the dictionary of a field.
+/// @param field The field.
+/// @param language The language of the values. Defaults to Languages::English.
+///                 A single language, as the token IDs of different languages index different tables.
+/// @param gender The gender of first names and titles. Defaults to Genders::M.
+///               A single gender, ignored by the other fields.
+/// @return The dictionary.
+/// @code
+/// faker::dictionary::get(faker::DictionaryFields::MaritalStatus).size();  // 5
+/// faker::dictionary::get(faker::DictionaryFields::FirstName, faker::Languages::Japanese, faker::Genders::F)[0];
+/// @endcode
+FAKER_EXPORT Dictionary get(
+    DictionaryFields field,
+    Languages language = Languages::English,
+    Genders gender     = Genders::M
+);
+
+/// @brief Generates the token ID of a random value of a field.
+///        The values are drawn as the string generators of the field draw them.
+/// @param field The field.
+/// @param language The language of the values. Defaults to Languages::English.
+/// @param gender The gender of first names and titles. Defaults to Genders::M.
+/// @return A token ID of the dictionary of the field.
+/// @code
+/// faker::dictionary::token_id(faker::DictionaryFields::JobTitle);  // 17
+/// @endcode
+FAKER_EXPORT TokenId token_id(
+    DictionaryFields field,
+    Languages language = Languages::English,
+    Genders gender     = Genders::M
+);
+
+/// @brief Fills a span with token IDs of random values of a field, to write a dictionary-encoded column.
+/// @param token_ids The span to fill.
+/// @param field The field.
+/// @param language The language of the values. Defaults to Languages::English.
+/// @param gender The gender of first names and titles. Defaults to Genders::M.
+/// @code
+/// std::array<faker::dictionary::TokenId, 1000> ids;
+/// faker::dictionary::fill_token_ids(ids, faker::DictionaryFields::LastName);  // {412, 87, 1033, ...}
+/// @endcode
+FAKER_EXPORT void fill_token_ids(
+    std::span<TokenId> token_ids,
+    DictionaryFields field,
+    Languages language = Languages::English,
+    Genders gender     = Genders::M
+);
+
+}  // namespace faker::dictionary
+
+#endif  // FAKER_DICTIONARY_H
@@ -10,6 +10,7 @@
 #include "faker/business.h"
 #include "faker/computer.h"
 #include "faker/datetime.h"
+#include "faker/dictionary.h"
 #include "faker/location.h"
 #include "faker/number.h"
 #include "faker/payment.h"
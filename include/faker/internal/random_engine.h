@@ -0,0 +1,24 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file random_engine.h
+
+#ifndef FAKER_INTERNAL_RANDOM_ENGINE_H
+#define FAKER_INTERNAL_RANDOM_ENGINE_H
+
+#include <random>
+
+#include "faker/internal/macros.h"
+
+namespace faker {
+
+/// @brief Provides a shared random engine instance for faker modules.
+///
+/// Exported so that the header-inline generators draw from the same per-thread engine as the library.
+/// @return Reference to the calling thread's std::mt19937_64 engine.
+FAKER_EXPORT std::mt19937_64& get_random_engine();
+
+}  // namespace faker
+
+#endif  // FAKER_INTERNAL_RANDOM_ENGINE_H
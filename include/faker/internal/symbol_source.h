@@ -0,0 +1,104 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file symbol_source.h
+
+#ifndef FAKER_SYMBOL_SOURCE_H
+#define FAKER_SYMBOL_SOURCE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+
+#include "faker/internal/macros.h"
+
+#if defined(FAKER_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+namespace faker {
+
+/// @brief High 64 bits of the 128-bit product of two 64-bit words.
+/// @param a The first factor.
+/// @param b The second factor.
+/// @return The high word of `a * b`.
+inline std::uint64_t multiply_high(const std::uint64_t a, const std::uint64_t b) {
+#if defined(FAKER_COMPILER_MSVC)
+    return __umulh(a, b);
+#else
+    __extension__ typedef unsigned __int128 uint128_t;
+    return static_cast<std::uint64_t>((static_cast<uint128_t>(a) * b) >> 64);
+#endif
+}
+
+/// @brief Draws uniformly distributed symbol indices, several per 64-bit engine word.
+///
+/// For an alphabet of `n` symbols, one engine word `x` is read as the fraction `x / 2^64` and its leading `k`
+/// base-`n` digits are peeled off one multiply-high at a time, where `k` is the largest count with `n^k <= 2^60`.
+/// Those `k` digits together are `floor(x * n^k / 2^64)`, so Lemire's multiply-high rejection on `n^k` makes every
+/// group of `k` symbols exactly uniform. A word is rejected with probability below 1/16, and never when `n` is a
+/// power of two. A 16-digit card number costs one engine call instead of sixteen.
+class SymbolSource {
+public:
+    /// @brief Create a source for an alphabet.
+    /// @param alphabet_size Number of symbols, must be in `[1, 2^60]`.
+    constexpr explicit SymbolSource(const std::size_t alphabet_size) : radix_(alphabet_size) {
+        while (symbols_per_word_ < kMaxSymbolsPerWord && range_ <= kMaxRange / radix_) {
+            range_ *= radix_;
+            ++symbols_per_word_;
+        }
+        threshold_ = (std::uint64_t{0} - range_) % range_;
+    }
+
+    /// @brief Number of symbols drawn from each accepted engine word.
+    [[nodiscard]] constexpr std::size_t symbols_per_word() const {
+        return symbols_per_word_;
+    }
+
+    /// @brief Draw the next symbol index.
+    /// @param engine The random engine.
+    /// @return A uniformly distributed index in `[0, alphabet_size)`.
+    std::size_t operator()(std::mt19937_64& engine) {
+        if (remaining_ == 0) {
+            std::uint64_t word = engine();
+            while (word * range_ < threshold_) { word = engine(); }
+            fraction_  = word;
+            remaining_ = symbols_per_word_;
+        }
+        --remaining_;
+        const std::uint64_t symbol = multiply_high(fraction_, radix_);
+        fraction_ *= radix_;
+        return static_cast<std::size_t>(symbol);
+    }
+
+private:
+    static constexpr std::uint64_t kMaxRange          = std::uint64_t{1} << 60;
+    static constexpr std::uint32_t kMaxSymbolsPerWord = 60;
+
+    std::uint64_t radix_;
+    std::uint64_t range_            = 1;
+    std::uint64_t threshold_        = 0;
+    std::uint64_t fraction_         = 0;
+    std::uint32_t symbols_per_word_ = 0;
+    std::uint32_t remaining_        = 0;
+};
+
+/// @brief Sources for alphabets of 1 to 64 symbols, precomputed at compile time.
+inline constexpr auto kSymbolSources = []<std::size_t... I>(std::index_sequence<I...>) {
+    return std::array{SymbolSource(I + 1)...};
+}(std::make_index_sequence<64>{});
+
+/// @brief Get a source for an alphabet, without the setup divisions for the common sizes.
+/// @param alphabet_size Number of symbols, must be in `[1, 2^60]`.
+/// @return A fresh source.
+inline SymbolSource make_symbol_source(const std::size_t alphabet_size) {
+    if (alphabet_size - 1 < kSymbolSources.size()) { return kSymbolSources[alphabet_size - 1]; }
+    return SymbolSource(alphabet_size);
+}
+
+}  // namespace faker
+
+#endif  // FAKER_SYMBOL_SOURCE_H
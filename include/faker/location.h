@@ -7,6 +7,9 @@
 #ifndef FAKER_LOCATION_H
 #define FAKER_LOCATION_H
 
+#include <optional>
+#include <string>
+
 #include "faker/internal/macros.h"
 #include "faker/types/bilingual.h"
 #include "faker/types/enums.h"
@@ -86,6 +89,8 @@ FAKER_EXPORT std::string region(
     Languages languages                         = Languages::English
 );
 
+struct AddressComponents;
+
 /// @brief Represents a location entity with a generated
 ///        address line 1, address line 2, postal code, full address and city
 ///        that are strongly correlated and contextually appropriate.
@@ -103,6 +108,8 @@ FAKER_EXPORT std::string region(
 /// l2.full_address();  // "辽宁省沈阳市沈河区五里河街道青年大街28号5座5层"
 /// l2.city();  // "沈阳市"
 /// @endcode
+/// @note Only the address is picked when the entity is constructed or rerolled; each field is generated on its first
+///       access and kept until the next reroll. An entity must not be read from several threads at once.
 class FAKER_EXPORT Location {
 public:
     /// @brief Constructs a location entity.
@@ -153,16 +160,17 @@ private:
     Regions regions_;
 
     // Selection.
-    Regions selected_region_ = Regions::UnitedStates;
+    Regions                  selected_region_   = Regions::UnitedStates;
+    const AddressComponents* address_component_ = nullptr;
 
-    // Generated data.
-    Bilingual   address_line1_;
-    Bilingual   address_line2_;
-    std::string postcode_;
-    Bilingual   full_address_;
-    Bilingual   city_;
+    // Generated data, each field on first access.
+    mutable std::optional<Bilingual>   address_line1_;
+    mutable std::optional<Bilingual>   address_line2_;
+    mutable std::optional<std::string> postcode_;
+    mutable std::optional<Bilingual>   full_address_;
+    mutable std::optional<Bilingual>   city_;
 
-    // Generates location data.
+    // Picks a new address and forgets the generated fields.
     void roll();
 };
 
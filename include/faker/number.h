@@ -8,9 +8,17 @@
 #define FAKER_NUMBER_H
 
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <source_location>
+#include <span>
 #include <string>
+#include <type_traits>
 
 #include "faker/internal/macros.h"
+#include "faker/internal/random_engine.h"
+#include "faker/internal/symbol_source.h"
 
 namespace faker::number {
 
@@ -85,6 +93,289 @@ FAKER_EXPORT T decimal(T start, T end, int decimal_places = 2);
 /// @endcode
 template <std::floating_point T>
 FAKER_EXPORT std::string decimal_string(T start, T end, int decimal_places = 2);
+
+namespace detail {
+
+/// @brief Throw if start is greater than end, as @code integer()@endcode does.
+template <typename T>
+FAKER_EXPORT void check_fill_range(T start, T end, const std::source_location& location);
+
+/// @brief The range of a decimal fill, in units of 10^-decimal_places.
+struct DecimalScale {
+    std::int64_t start;
+    std::int64_t end;
+    double       factor;
+};
+
+/// @brief Validate decimal places and a decimal range and scale it, as @code decimal()@endcode does.
+FAKER_EXPORT DecimalScale
+    scale_decimal_range(double start, double end, int decimal_places, const std::source_location& location);
+
+/// @brief Fill with `convert(start + offset)`, where each offset is uniform in `[0, span]`.
+///
+/// Spans below 2^60 draw several offsets from each engine word, see @code SymbolSource@endcode.
+/// Wider spans use one word per offset, with Lemire's multiply-high rejection.
+template <typename T, typename Convert>
+void fill_uniform(const std::span<T> out, const std::uint64_t start, const std::uint64_t span, Convert convert) {
+    std::mt19937_64& random_engine = get_random_engine();
+
+    if (span < std::uint64_t{1} << 60) {
+        SymbolSource source = make_symbol_source(span + 1);
+        for (T& value : out) { value = convert(start + source(random_engine)); }
+    } else if (span == ~std::uint64_t{0}) {
+        for (T& value : out) { value = convert(start + random_engine()); }
+    } else {
+        const std::uint64_t bound     = span + 1;
+        const std::uint64_t threshold = (0 - bound) % bound;
+        for (T& value : out) {
+            std::uint64_t word = random_engine();
+            while (word * bound < threshold) { word = random_engine(); }
+            value = convert(start + multiply_high(word, bound));
+        }
+    }
+}
+
+template <std::integral T>
+void fill_uniform_integers(const std::span<T> out, const T start, const T end) {
+    using U = std::make_unsigned_t<T>;
+
+    // Offsets are added modulo 2^64 and truncated to U, which maps back into [start, end] for signed T too.
+    const auto first = static_cast<std::uint64_t>(static_cast<U>(start));
+    const auto span  = static_cast<std::uint64_t>(static_cast<U>(static_cast<U>(end) - static_cast<U>(start)));
+    fill_uniform(out, first, span, [](const std::uint64_t value) { return static_cast<T>(static_cast<U>(value)); });
+}
+
+}  // namespace detail
+
+/// @brief Fill a span with random integers between start and end.
+///
+/// The range is validated once and the values are drawn in one loop, several from each 64-bit random word when the
+/// range is narrow. Equivalent to calling @code integer()@endcode for every element, but much faster.
+///
+/// @tparam T Signed integer type (e.g., int32_t, int64_t).
+/// @param out The span to fill.
+/// @param start Minimum value.
+/// @param end Maximum value.
+/// @code
+/// std::vector<int> column(1'000'000);
+/// faker::number::fill_integers(std::span(column), -1000, 1000);
+/// @endcode
+template <std::integral T>
+    requires(std::is_signed_v<T>)
+void fill_integers(
+    const std::span<T>            out,
+    const std::type_identity_t<T> start,
+    const std::type_identity_t<T> end,
+    const std::source_location&   location = std::source_location::current()
+) {
+    detail::check_fill_range<T>(start, end, location);
+    detail::fill_uniform_integers(out, start, end);
+}
+
+/// @brief Fill a span with random unsigned integers between start and end.
+///
+/// Equivalent to calling @code unsigned_integer()@endcode for every element, but much faster.
+///
+/// @tparam T Unsigned integer type (e.g., uint32_t, uint64_t).
+/// @param out The span to fill.
+/// @param start Minimum value.
+/// @param end Maximum value.
+/// @code
+/// std::vector<uint8_t> column(1'000'000);
+/// faker::number::fill_unsigned_integers(std::span(column), 0, 200);
+/// @endcode
+template <std::integral T>
+    requires(std::is_unsigned_v<T>)
+void fill_unsigned_integers(
+    const std::span<T>            out,
+    const std::type_identity_t<T> start,
+    const std::type_identity_t<T> end,
+    const std::source_location&   location = std::source_location::current()
+) {
+    detail::check_fill_range<T>(start, end, location);
+    detail::fill_uniform_integers(out, start, end);
+}
+
+/// @brief Fill a span with random decimal numbers between start and end.
+///
+/// Each value is a multiple of 10^-decimal_places, like @code decimal()@endcode, which this is equivalent to calling
+/// for every element.
+///
+/// @tparam T Floating point type (e.g., float, double).
+/// @param out The span to fill.
+/// @param start Minimum value.
+/// @param end Maximum value.
+/// @param decimal_places Number of decimal places.
+/// @code
+/// std::vector<double> prices(1'000'000);
+/// faker::number::fill_decimals(std::span(prices), 0.0, 500.0);  // 12.99, 407.5, ...
+/// @endcode
+template <std::floating_point T>
+void fill_decimals(
+    const std::span<T>            out,
+    const std::type_identity_t<T> start,
+    const std::type_identity_t<T> end,
+    const int                     decimal_places = 2,
+    const std::source_location&   location       = std::source_location::current()
+) {
+    detail::check_fill_range<T>(start, end, location);
+    const detail::DecimalScale scale = detail::scale_decimal_range(
+        static_cast<double>(start),
+        static_cast<double>(end),
+        decimal_places,
+        location
+    );
+    const double factor = scale.factor;
+    const auto   first  = static_cast<std::uint64_t>(scale.start);
+    const auto   span   = static_cast<std::uint64_t>(scale.end) - first;
+    detail::fill_uniform(out, first, span, [factor](const std::uint64_t value) {
+        return static_cast<T>(static_cast<double>(static_cast<std::int64_t>(value)) / factor);
+    });
+}
+
+/// @brief Fill a span with random real numbers uniformly distributed in [start, end).
+///
+/// Each value takes the top 53 bits of one 64-bit random word.
+///
+/// @tparam T Floating point type (e.g., float, double).
+/// @param out The span to fill.
+/// @param start Minimum value.
+/// @param end Upper bound, it is only reached through rounding.
+/// @code
+/// std::vector<double> weights(1'000'000);
+/// faker::number::fill_reals(std::span(weights), 0.0, 1.0);  // 0.4170220047, 0.7203244934, ...
+/// @endcode
+template <std::floating_point T>
+void fill_reals(
+    const std::span<T>            out,
+    const std::type_identity_t<T> start,
+    const std::type_identity_t<T> end,
+    const std::source_location&   location = std::source_location::current()
+) {
+    detail::check_fill_range<T>(start, end, location);
+
+    std::mt19937_64& random_engine = get_random_engine();
+    const double     low           = static_cast<double>(start);
+    const double     width         = static_cast<double>(end) - low;
+    for (T& value : out) {
+        const double fraction = static_cast<double>(random_engine() >> 11) * 0x1p-53;
+        value                 = static_cast<T>(low + width * fraction);
+    }
+}
+
+/// @brief Generate a normally distributed random number.
+/// @tparam T Floating point type (e.g., float, double).
+/// @param mean The mean.
+/// @param stddev The standard deviation. If not greater than 0, throw error.
+/// @return A normally distributed number.
+/// @code
+/// faker::number::normal();  // -0.3706954258
+/// faker::number::normal(170.0, 10.0);  // 176.83
+/// @endcode
+template <std::floating_point T = double>
+FAKER_EXPORT T normal(T mean = 0, T stddev = 1);
+
+/// @brief Fill a span with normally distributed random numbers.
+/// @tparam T Floating point type (e.g., float, double).
+/// @param out The span to fill.
+/// @param mean The mean.
+/// @param stddev The standard deviation. If not greater than 0, throw error.
+/// @code
+/// std::vector<double> heights(1'000'000);
+/// faker::number::fill_normal(std::span(heights), 170.0, 10.0);
+/// @endcode
+template <std::floating_point T>
+FAKER_EXPORT void fill_normal(std::span<T> out, std::type_identity_t<T> mean = 0, std::type_identity_t<T> stddev = 1);
+
+/// @brief Generate a log-normally distributed random number, i.e. `exp(normal(mu, sigma))`.
+/// @tparam T Floating point type (e.g., float, double).
+/// @param mu The mean of the logarithm.
+/// @param sigma The standard deviation of the logarithm. If not greater than 0, throw error.
+/// @return A positive log-normally distributed number.
+/// @code
+/// faker::number::lognormal(3.0, 0.5);  // 24.71, e.g. an order value
+/// @endcode
+template <std::floating_point T = double>
+FAKER_EXPORT T lognormal(T mu = 0, T sigma = 1);
+
+/// @brief Fill a span with log-normally distributed random numbers.
+/// @tparam T Floating point type (e.g., float, double).
+/// @param out The span to fill.
+/// @param mu The mean of the logarithm.
+/// @param sigma The standard deviation of the logarithm. If not greater than 0, throw error.
+/// @code
+/// std::vector<double> order_values(1'000'000);
+/// faker::number::fill_lognormal(std::span(order_values), 3.0, 0.5);
+/// @endcode
+template <std::floating_point T>
+FAKER_EXPORT void fill_lognormal(std::span<T> out, std::type_identity_t<T> mu = 0, std::type_identity_t<T> sigma = 1);
+
+/// @brief Generate an exponentially distributed random number.
+/// @tparam T Floating point type (e.g., float, double).
+/// @param rate The rate, i.e. 1 / mean. If not greater than 0, throw error.
+/// @return A non-negative exponentially distributed number.
+/// @code
+/// faker::number::exponential(0.05);  // 12.86, e.g. a latency in ms with a mean of 20
+/// @endcode
+template <std::floating_point T = double>
+FAKER_EXPORT T exponential(T rate = 1);
+
+/// @brief Fill a span with exponentially distributed random numbers.
+/// @tparam T Floating point type (e.g., float, double).
+/// @param out The span to fill.
+/// @param rate The rate, i.e. 1 / mean. If not greater than 0, throw error.
+/// @code
+/// std::vector<double> latencies(1'000'000);
+/// faker::number::fill_exponential(std::span(latencies), 0.05);
+/// @endcode
+template <std::floating_point T>
+FAKER_EXPORT void fill_exponential(std::span<T> out, std::type_identity_t<T> rate = 1);
+
+/// @brief Generate a Pareto distributed random number.
+/// @tparam T Floating point type (e.g., float, double).
+/// @param scale The minimum value. If not greater than 0, throw error.
+/// @param shape The shape, smaller is heavier-tailed. If not greater than 0, throw error.
+/// @return A Pareto distributed number, at least `scale`.
+/// @code
+/// faker::number::pareto(1000.0, 1.16);  // 1873.4, 80% of the total in 20% of the draws
+/// @endcode
+template <std::floating_point T = double>
+FAKER_EXPORT T pareto(T scale = 1, T shape = 1);
+
+/// @brief Fill a span with Pareto distributed random numbers.
+/// @tparam T Floating point type (e.g., float, double).
+/// @param out The span to fill.
+/// @param scale The minimum value. If not greater than 0, throw error.
+/// @param shape The shape, smaller is heavier-tailed. If not greater than 0, throw error.
+/// @code
+/// std::vector<double> incomes(1'000'000);
+/// faker::number::fill_pareto(std::span(incomes), 1000.0, 1.16);
+/// @endcode
+template <std::floating_point T>
+FAKER_EXPORT void fill_pareto(std::span<T> out, std::type_identity_t<T> scale = 1, std::type_identity_t<T> shape = 1);
+
+/// @brief Generate a Zipf distributed rank.
+///
+/// Rank `k` has probability proportional to `k^-exponent`, e.g. the popularity rank of a product.
+/// The cost does not depend on `element_count`.
+/// @param element_count Number of ranks. If 0, throw error.
+/// @param exponent The exponent, larger is more skewed. If not greater than 0, throw error.
+/// @return A rank in `[1, element_count]`.
+/// @code
+/// faker::number::zipf(1'000'000);  // 3
+/// @endcode
+FAKER_EXPORT std::uint64_t zipf(std::uint64_t element_count, double exponent = 1);
+
+/// @brief Fill a span with Zipf distributed ranks.
+/// @param out The span to fill.
+/// @param element_count Number of ranks. If 0, throw error.
+/// @param exponent The exponent, larger is more skewed. If not greater than 0, throw error.
+/// @code
+/// std::vector<uint64_t> product_ids(1'000'000);
+/// faker::number::fill_zipf(std::span(product_ids), 50'000, 1.1);
+/// @endcode
+FAKER_EXPORT void fill_zipf(std::span<std::uint64_t> out, std::uint64_t element_count, double exponent = 1);
+
 }  // namespace faker::number
 
 #endif  // FAKER_NUMBER_H
@@ -7,8 +7,11 @@
 #ifndef FAKER_PAYMENT_H
 #define FAKER_PAYMENT_H
 
+#include <cstddef>
 #include <source_location>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include "faker/internal/macros.h"
 #include "faker/types/enums.h"
@@ -49,6 +52,7 @@ FAKER_EXPORT std::string card_type(
 );
 
 /// @brief Generates a random card number.
+///        The last digit is a valid Luhn check digit.
 /// @param card_types The selected card types.
 ///                   If multiple card types are specified, bitwise(bitwise_or |) operator can be used.
 ///                   Defaults to CardTypes::AmericanExpress, CardTypes::JCB,
@@ -63,6 +67,28 @@ FAKER_EXPORT std::string card_number(
         CardTypes::AmericanExpress | CardTypes::JCB | CardTypes::MasterCard | CardTypes::UnionPay | CardTypes::Visa
 );
 
+/// @brief Checks whether a card number passes the Luhn check.
+/// @param card_number The card number, digits only.
+/// @return True if the card number has at least two digits and a valid check digit.
+/// @code
+/// faker::payment::is_valid_card_number("4111111111111111");  // true
+/// faker::payment::is_valid_card_number("4111111111111112");  // false
+/// @endcode
+FAKER_EXPORT bool is_valid_card_number(std::string_view card_number);
+
+/// @brief Checks many card numbers at once with the Luhn check.
+/// @param card_numbers Card numbers, each terminated by the delimiter. The last one may omit it.
+/// @param results One result per card number, true if valid.
+/// @param delimiter Delimiter of card numbers. Defaults to '\n'.
+/// @return The number of card numbers checked, at most the size of results.
+/// @code
+/// const std::string_view numbers = "4111111111111111\n4111111111111112\n";
+/// bool results[2];
+/// faker::payment::validate_card_numbers(numbers, results);  // 2, results = {true, false}
+/// @endcode
+FAKER_EXPORT std::size_t
+    validate_card_numbers(std::span<const char> card_numbers, std::span<bool> results, char delimiter = '\n');
+
 /// @brief Generates a random issue or valid through date of a card.
 /// @param start The start month in the format of "mm/YY". Defaults to "01/00".
 /// @param end The end month in the format of "mm/YY". Defaults to "12/50".
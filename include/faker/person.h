@@ -7,7 +7,11 @@
 #ifndef FAKER_PERSON_H
 #define FAKER_PERSON_H
 
+#include <cstddef>
+#include <span>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "faker/internal/macros.h"
 #include "faker/types/bilingual.h"
@@ -119,18 +123,48 @@ FAKER_EXPORT std::string phone_number(
 /// @param languages The languages of the email. Defaults to Languages::English.
 ///                  If multiple languages are specified, bitwise(bitwise_or |) operator can be used.
 /// @param domains The list of domains. Defaults to "gmail.com,hotmail.com".
-///                If empty, throw error.
+///                Domains are trimmed and empty ones skipped. If no domain is left, throw error.
 /// @param delimiter Delimiter of domains.
+/// @param lowercase Whether the email is written in lowercase. Defaults to false.
 /// @return An email.
+/// @note The user name is made from the romanized full name, without spaces, hyphens or accents.
 /// @code
 /// faker::person::email();  // "CannonDean7011@gmail.com"
 /// faker::person::email(faker::Languages::SimplifiedChinese | faker::Languages::TraditionalChinese,
 ///                      "163.com, qq.com", ',');  // "LengYiyi987@163.com"
+/// faker::person::email(faker::Languages::Japanese, "gmail.com", ',', true);  // "satoyuko.live@gmail.com"
 /// @endcode
 FAKER_EXPORT std::string email(
     Languages languages      = Languages::English,
     std::string_view domains = "gmail.com,hotmail.com",
-    char delimiter           = ','
+    char delimiter           = ',',
+    bool lowercase           = false
+);
+
+/// @brief Generates random emails into a contiguous buffer.
+/// @param buffer The buffer to write to.
+/// @param count The number of emails to write.
+///              Stops early at the last whole email that fits in the buffer.
+/// @param languages The languages of the emails. Defaults to Languages::English.
+///                  If multiple languages are specified, bitwise(bitwise_or |) operator can be used.
+/// @param domains The list of domains. Defaults to "gmail.com,hotmail.com".
+///                Domains are trimmed and empty ones skipped. If no domain is left, throw error.
+/// @param domains_delimiter Delimiter of domains.
+/// @param lowercase Whether the emails are written in lowercase. Defaults to false.
+/// @param delimiter Written after each email. Defaults to '\n'.
+/// @return The number of bytes written.
+/// @code
+/// char buffer[64 * 1000];
+/// faker::person::emails(buffer, 1000);  // 26031, "CannonDean7011@gmail.com\nimSpencerHenson@hotmail.com\n..."
+/// @endcode
+FAKER_EXPORT std::size_t emails(
+    std::span<char> buffer,
+    std::size_t count,
+    Languages languages      = Languages::English,
+    std::string_view domains = "gmail.com,hotmail.com",
+    char domains_delimiter   = ',',
+    bool lowercase           = false,
+    char delimiter           = '\n'
 );
 
 /// @brief Generates a random job title.
@@ -180,6 +214,15 @@ FAKER_EXPORT Bilingual social_network_id(Languages languages = Languages::Englis
 /// p2.email();  // "TsoSzeching.live@qq.com"
 /// p2.job_title();  // "心理諮商師"
 /// p2.social_network_id();  // "獅子山下呀"
+/// faker::person::Person p3(
+///     faker::Genders::M | faker::Genders::F,
+///     faker::Languages::English,
+///     faker::Regions::UnitedStates,
+///     "gmail.com",
+///     ',',
+///     faker::PersonFields::FullName | faker::PersonFields::Email);
+/// p3.full_name();  // "Spencer Henson"
+/// p3.email();  // "SpencerHenson_live@gmail.com"
 /// @endcode
 class FAKER_EXPORT Person {
 public:
@@ -191,14 +234,20 @@ public:
     /// @param regions Regions. Defaults to Regions::UnitedStates.
     ///                             If multiple regions are specified, bitwise(bitwise_or |) operator can be used.
     /// @param email_domains The list of domains. Defaults to "gmail.com,hotmail.com".
-    ///                      If empty, throw error.
+    ///                      Domains are trimmed and empty ones skipped. If no domain is left, throw error.
     /// @param email_domains_delimiter Delimiter of domains.
+    /// @param fields The fields to generate. Defaults to PersonFields::All.
+    ///               If multiple fields are specified, bitwise(bitwise_or |) operator can be used.
+    ///               The fields a requested field is made from are generated too: the first and last names for the
+    ///               full name and the email, and the marital status for the title. Reading a field that is not
+    ///               generated throws std::logic_error.
     explicit Person(
         Genders genders                = Genders::M | Genders::F,
         Languages languages            = Languages::English,
         Regions regions                = Regions::UnitedStates,
         std::string_view email_domains = "gmail.com,hotmail.com",
-        char email_domains_delimiter   = ','
+        char email_domains_delimiter   = ',',
+        PersonFields fields            = PersonFields::All
     );
 
     /// @brief Destroys the person entity.
@@ -242,11 +291,11 @@ public:
 
 private:
     // Constructor parameters
-    Genders     genders_;
-    Languages   languages_;
-    Regions     regions_;
-    std::string email_domains_;
-    char        email_domains_delimiter_;
+    Genders                  genders_;
+    Languages                languages_;
+    Regions                  regions_;
+    std::vector<std::string> email_domains_;
+    PersonFields             fields_;
 
     // Selection
     Genders   selected_gender_   = Genders::M;
@@ -7,6 +7,8 @@
 #ifndef FAKER_PRODUCT_H
 #define FAKER_PRODUCT_H
 
+#include <cstddef>
+#include <span>
 #include <string>
 
 #include "faker/internal/macros.h"
@@ -64,6 +66,8 @@ FAKER_EXPORT std::string color(Languages languages = Languages::English);
 FAKER_EXPORT std::string size();
 
 /// @brief Generates a random barcode string.
+///        The last digit is a valid check digit: GS1 mod 10 for EAN-13, EAN-8, UPC-A and ISBN-13,
+///        and the check digit of the expanded UPC-A number for 8-digit UPC-E.
 /// @param barcode_types The types of barcode. Defaults to BarcodeTypes::EAN13.
 /// @return A barcode string.
 /// @code
@@ -75,6 +79,24 @@ FAKER_EXPORT std::string size();
 /// @endcode
 FAKER_EXPORT std::string barcode(BarcodeTypes barcode_types = BarcodeTypes::EAN13);
 
+/// @brief Generates random barcodes into a contiguous buffer.
+/// @param buffer The buffer to write to.
+/// @param count The number of barcodes to write.
+///              Stops early at the last whole barcode that fits in the buffer.
+/// @param barcode_types The types of barcode. Defaults to BarcodeTypes::EAN13.
+/// @param delimiter Written after each barcode. Defaults to '\n'.
+/// @return The number of bytes written.
+/// @code
+/// char buffer[14 * 1000];
+/// faker::product::barcodes(buffer, 1000);  // 14000, "1347237267997\n4006381333931\n..."
+/// @endcode
+FAKER_EXPORT std::size_t barcodes(
+    std::span<char> buffer,
+    std::size_t     count,
+    BarcodeTypes    barcode_types = BarcodeTypes::EAN13,
+    char            delimiter     = '\n'
+);
+
 }  // namespace faker::product
 
 #endif  // FAKER_PRODUCT_H
@@ -7,9 +7,14 @@
 #ifndef FAKER_STRING_H
 #define FAKER_STRING_H
 
+#include <cstddef>
+#include <iosfwd>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include "faker/internal/macros.h"
+#include "faker/types/enums.h"
 
 namespace faker::string {
 
@@ -24,6 +29,9 @@ namespace faker::string {
 FAKER_EXPORT std::string enum_item(std::string_view enums, char delimiter);
 
 /// @brief Generates a random text.
+///
+/// The text starts at the beginning of a paragraph and ends with a whole word, unless no word ends within the range.
+/// Even then, a multi-byte UTF-8 character is never cut.
 /// @param number_of_chars_start Minimum number of characters. Defaults to 100.
 /// @param number_of_chars_end Maximum number of characters. Defaults to 10,000.
 /// @return A random text.
@@ -33,14 +41,119 @@ FAKER_EXPORT std::string enum_item(std::string_view enums, char delimiter);
 /// @endcode
 FAKER_EXPORT std::string text(unsigned int number_of_chars_start = 100, unsigned int number_of_chars_end = 10000);
 
+/// @brief Generates a random text as a view of the static text corpus, without copying it.
+///
+/// The length is drawn and aligned as in @code text()@endcode, then capped at the size of the corpus.
+/// @param number_of_chars_start Minimum number of characters. Defaults to 100.
+///                              If greater than the size of the corpus (about 46,000 characters), throw error.
+/// @param number_of_chars_end Maximum number of characters. Defaults to 10,000.
+/// @return A view of the corpus, valid for the lifetime of the program.
+/// @code
+/// faker::string::text_view(20, 40);  // "computable function can be computed b"
+/// @endcode
+FAKER_EXPORT std::string_view
+    text_view(unsigned int number_of_chars_start = 100, unsigned int number_of_chars_end = 10000);
+
+/// @brief Generates consecutive words of the text corpus, starting at a random word.
+/// @param count Number of words. The words keep their punctuation.
+/// @return The words, separated as in the corpus.
+/// @code
+/// faker::string::words(3);  // "forming the theoretical"
+/// @endcode
+FAKER_EXPORT std::string words(std::size_t count);
+
+/// @brief Generates consecutive sentences of the text corpus, starting at a random sentence.
+/// @param count Number of sentences.
+/// @return The sentences, separated as in the corpus.
+/// @code
+/// faker::string::sentences(1);  // "This profound insight implies that all computational systems ..."
+/// @endcode
+FAKER_EXPORT std::string sentences(std::size_t count);
+
+/// @brief Fills a buffer with random text.
+///
+/// The text starts at a random paragraph of the corpus and runs on through the following ones, copied a whole chunk
+/// at a time, so filling a large blob costs about as much as a memcpy.
+/// @param buffer The buffer to fill.
+/// @return The number of characters written, i.e. the buffer size.
+/// @code
+/// std::vector<char> blob(4 << 20);
+/// faker::string::write_text(blob);
+/// @endcode
+FAKER_EXPORT std::size_t write_text(std::span<char> buffer);
+
+/// @brief Writes random text to a stream, in chunks straight from the corpus.
+/// @param out The stream to write to.
+/// @param number_of_chars Number of characters to write.
+/// @code
+/// faker::string::write_text(std::cout, 1 << 20);
+/// @endcode
+FAKER_EXPORT void write_text(std::ostream& out, std::size_t number_of_chars);
+
+/// @brief Generates novel text from a word-level Markov chain trained on the text corpus.
+///
+/// Each word is drawn from the words that follow the previous `order` words somewhere in the corpus, so the text
+/// reads like the corpus without repeating its paragraphs. Lower orders and higher randomness give more varied text,
+/// which compresses worse: order 3 mostly replays corpus phrases, order 1 only keeps word pairs.
+/// The chains are trained on first use.
+/// @param number_of_words Number of words.
+/// @param order Number of previous words a word depends on, in `[1, 3]`. Defaults to 2.
+/// @param randomness Probability, in `[0, 1]`, of restarting the chain at a random corpus word before each word.
+///                   Defaults to 0.
+/// @return The words, keeping their punctuation and separated by single spaces.
+/// @code
+/// faker::string::markov_text(6);  // "every computable function can be simulated"
+/// @endcode
+FAKER_EXPORT std::string markov_text(std::size_t number_of_words, unsigned int order = 2, double randomness = 0);
+
+/// @brief Fills a buffer with Markov text, see @code markov_text()@endcode.
+///
+/// Each word is followed by a space, and the text stops at the last whole word that fits. Bytes past the returned
+/// size are unspecified.
+/// @param buffer The buffer to fill.
+/// @param order Number of previous words a word depends on, in `[1, 3]`. Defaults to 2.
+/// @param randomness Probability, in `[0, 1]`, of restarting the chain at a random corpus word before each word.
+///                   Defaults to 0.
+/// @return The number of characters written.
+/// @code
+/// std::vector<char> blob(4 << 20);
+/// blob.resize(faker::string::write_markov_text(blob, 1, 0.1));
+/// @endcode
+FAKER_EXPORT std::size_t write_markov_text(std::span<char> buffer, unsigned int order = 2, double randomness = 0);
+
 /// @brief Generates a UUID string.
 /// @param include_hyphens Whether the UUID should include hyphens (-). Defaults to true.
-/// @return A UUID v4 string.
+/// @param version The UUID version. Defaults to UuidVersion::V4.
+///                UuidVersion::V7 UUIDs start with the Unix time in milliseconds, and are strictly increasing
+///                within a thread, so that they keep B-tree inserts local.
+/// @return A UUID string.
 /// @code
 /// faker::string::uuid();  // "d6c86f3d-3221-4b6a-b120-ec9b9fb66ac2"
 /// faker::string::uuid(false);  // "c8c303b7229349489d96ab804e3d80dd"
+/// faker::string::uuid(true, faker::UuidVersion::V7);  // "019a1f2e-4c8b-7a3d-9e21-5f0c6b7d8e9f"
+/// @endcode
+FAKER_EXPORT std::string uuid(bool include_hyphens = true, UuidVersion version = UuidVersion::V4);
+
+/// @brief Generates UUID strings into a contiguous buffer.
+///        Every UUID is followed by the delimiter, so each one takes 37 bytes, or 33 bytes without hyphens.
+/// @param buffer The buffer to write to.
+/// @param count The number of UUIDs to write.
+///              Stops early at the last whole UUID that fits in the buffer.
+/// @param include_hyphens Whether the UUIDs should include hyphens (-). Defaults to true.
+/// @param version The UUID version. Defaults to UuidVersion::V4.
+/// @param delimiter Written after each UUID. Defaults to '\n'.
+/// @return The number of bytes written.
+/// @code
+/// char buffer[37 * 1000];
+/// faker::string::uuid_batch(buffer, 1000);  // 37000, "d6c86f3d-3221-4b6a-b120-ec9b9fb66ac2\n..."
 /// @endcode
-FAKER_EXPORT std::string uuid(bool include_hyphens = true);
+FAKER_EXPORT std::size_t uuid_batch(
+    std::span<char> buffer,
+    std::size_t     count,
+    bool            include_hyphens = true,
+    UuidVersion     version         = UuidVersion::V4,
+    char            delimiter       = '\n'
+);
 
 }  // namespace faker::string
 
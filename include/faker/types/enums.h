@@ -47,6 +47,38 @@ enum class Regions {
 template <>
 struct enable_bitwise_operators<Regions> : std::true_type {};
 
+/// @brief Fields of a person entity
+///  If you want to use multiple fields, you can use bitwise(bitwise_or |) operators.
+enum class PersonFields {
+    FirstName       = 1 << 0,         // First name
+    LastName        = 1 << 1,         // Last name
+    FullName        = 1 << 2,         // Full name, with the first and last names
+    Gender          = 1 << 3,         // Gender
+    Title           = 1 << 4,         // Title, with the marital status
+    MaritalStatus   = 1 << 5,         // Marital status
+    PhoneNumber     = 1 << 6,         // Phone number
+    Email           = 1 << 7,         // Email, with the full name
+    JobTitle        = 1 << 8,         // Job title
+    SocialNetworkId = 1 << 9,         // Social network ID
+    All             = (1 << 10) - 1,  // Every field
+};
+template <>
+struct enable_bitwise_operators<PersonFields> : std::true_type {};
+
+/// @brief Fields picked from a data table, which can be generated as token IDs
+enum class DictionaryFields {
+    FirstName,        // person::first_name()
+    LastName,         // person::last_name()
+    Gender,           // person::gender()
+    Title,            // person::title()
+    MaritalStatus,    // person::marital_status()
+    JobTitle,         // person::job_title()
+    Department,       // business::department()
+    Industry,         // business::industry()
+    ProductCategory,  // product::product_category()
+    Color,            // product::color()
+};
+
 /// @brief Country Codes Standard
 enum class CountryCodesStandard {
     None,                // None, output as name
@@ -90,6 +122,29 @@ enum class IpAddressType {
     IPv6,  // IPv6
 };
 
+/// @brief IP address options
+///  If you want to use multiple options, you can use bitwise(bitwise_or |) operators.
+enum class IpAddressOptions {
+    None            = 0,       // No option
+    ExcludeReserved = 1 << 0,  // Skip special-purpose blocks: private, loopback, link-local, multicast, documentation...
+    CompressIPv6    = 1 << 1,  // Write IPv6 in the RFC 5952 form: no leading zeros, longest zero run as "::"
+};
+template <>
+struct enable_bitwise_operators<IpAddressOptions> : std::true_type {};
+
+/// @brief Arrival processes of event time sequences
+enum class ArrivalProcess {
+    Poisson,  // Constant rate, exponential gaps
+    Diurnal,  // Rate following a daily cycle
+    Bursty,   // Calm periods and bursts at a higher rate
+};
+
+/// @brief UUID versions
+enum class UuidVersion {
+    V4,  // Random
+    V7,  // Unix epoch time-ordered
+};
+
 /// @brief Operating systems
 ///  If you want to use multiple operating systems, you can use bitwise(bitwise_or |) operators.
 enum class OperatingSystems {
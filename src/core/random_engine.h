@@ -7,14 +7,6 @@
 #ifndef FAKER_RANDOM_ENGINE_H
 #define FAKER_RANDOM_ENGINE_H
 
-#include <random>
-
-namespace faker {
-
-/// @brief Provides a shared random engine instance for faker modules.
-/// @return Reference to a global std::mt19937_64 engine.
-std::mt19937_64& get_random_engine();
-
-}  // namespace faker
+#include "faker/internal/random_engine.h"
 
 #endif  // FAKER_RANDOM_ENGINE_H
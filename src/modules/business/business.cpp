@@ -43,17 +43,10 @@ static Industries pick_industry() {
 
 // Get a company name
 static Bilingual get_company_name(const Languages language, const Industries industry) {
-    BilingualView business_words_view;
-    const auto    selected_language_it = kBusinessWords.find(language);
-    if (selected_language_it != kBusinessWords.end()) {
-        const auto& industries_map = selected_language_it->second;
-        const auto  industries_it  = industries_map.find(industry);
-        if (industries_it != industries_map.end() && !industries_it->second.empty()) {
-            business_words_view = pick_one(industries_it->second);
-        } else {
-            business_words_view = pick_one(industries_map.at(Industries::Trading));
-        }
-    }
+    // Industries without words of their own fall back to trading.
+    const auto&         industries_words    = kBusinessWords[language];
+    const auto          words               = industries_words[industry];
+    const BilingualView business_words_view = pick_one(words.empty() ? industries_words[Industries::Trading] : words);
 
     BilingualView company_suffixes_view;
     BilingualView last_name_suffixes_view;
@@ -62,22 +55,22 @@ static Bilingual get_company_name(const Languages language, const Industries ind
     case Languages::English:
         company_suffixes_view   = pick_one(kEnglishCompanySuffixes);
         last_name_suffixes_view = pick_one(kEnglishLastNameSuffixes);
-        last_name_view          = pick_one(person::kEnglishLastNames);
+        last_name_view          = pick_one(person::kEnglishLastNamePool);
         break;
     case Languages::SimplifiedChinese:
         company_suffixes_view   = pick_one(kSimplifiedChineseCompanySuffixes);
         last_name_suffixes_view = pick_one(kSimplifiedChineseLastNameSuffixes);
-        last_name_view          = pick_one(person::kSimplifiedChineseLastNames);
+        last_name_view          = pick_one(person::kSimplifiedChineseLastNamePool);
         break;
     case Languages::TraditionalChinese:
         company_suffixes_view   = pick_one(kTraditionalChineseCompanySuffixes);
         last_name_suffixes_view = pick_one(kTraditionalChineseLastNameSuffixes);
-        last_name_view          = pick_one(person::kTraditionalChineseLastNames);
+        last_name_view          = pick_one(person::kTraditionalChineseLastNamePool);
         break;
     case Languages::Japanese:
         company_suffixes_view   = pick_one(kJapaneseCompanySuffixes);
         last_name_suffixes_view = pick_one(kJapaneseLastNameSuffixes);
-        last_name_view          = pick_one(person::kJapaneseLastNames);
+        last_name_view          = pick_one(person::kJapaneseLastNamePool);
         break;
     }
 
@@ -118,18 +111,9 @@ static Bilingual get_company_name(const Languages language, const Industries ind
 }
 
 static std::string get_industry(const Languages languages, const Industries industry) {
-    std::string_view industry_string;
-    const auto       selected_language_it = kIndustries.find(languages);
-    if (selected_language_it != kIndustries.end()) {
-        const auto& industries_map = selected_language_it->second;
-        const auto  industries_it  = industries_map.find(industry);
-        if (industries_it != industries_map.end() && !industries_it->second.empty()) {
-            industry_string = industries_it->second;
-        } else {
-            industry_string = industries_map.at(Industries::Trading);
-        }
-    }
-    return std::string(industry_string);
+    const auto&            industries      = kIndustries[languages];
+    const std::string_view industry_string = industries[industry];
+    return std::string(industry_string.empty() ? industries[Industries::Trading] : industry_string);
 }
 
 Bilingual company_name(const Languages languages) {
@@ -10,8 +10,8 @@
 #include <array>
 #include <span>
 #include <string_view>
-#include <unordered_map>
 
+#include "enum_table.h"
 #include "faker/types/bilingual.h"
 #include "faker/types/enums.h"
 
@@ -80,7 +80,7 @@ constexpr auto kJapaneseLastNameSuffixes = std::to_array<BilingualView>({
     {"商店", " Shoten"},
 });
 
-const std::unordered_map<Languages, std::unordered_map<Industries, std::string_view>> kIndustries = {
+constexpr EnumTable<Languages, EnumTable<Industries, std::string_view, 13>, 4> kIndustries = {
     {Languages::English,
      {
          {Industries::Catering, "Catering industry"},
@@ -146,6 +146,7 @@ const std::unordered_map<Languages, std::unordered_map<Industries, std::string_v
          {Industries::Trading, "貿易業界"},
      }},
 };
+static_assert(kIndustries.is_complete());
 
 constexpr auto kEnglishCateringBusinessWords = std::to_array<BilingualView>({
     {"Catering", "Catering"},
@@ -459,7 +460,7 @@ constexpr auto kJapaneseTradingBusinessWords = std::to_array<BilingualView>({
     {"商業", "Commerce"},
 });
 
-const std::unordered_map<Languages, std::unordered_map<Industries, std::span<const BilingualView>>> kBusinessWords = {
+constexpr EnumTable<Languages, EnumTable<Industries, std::span<const BilingualView>, 13>, 4> kBusinessWords = {
     {Languages::English,
      {
          {Industries::Catering, kEnglishCateringBusinessWords},
@@ -525,6 +526,7 @@ const std::unordered_map<Languages, std::unordered_map<Industries, std::span<con
          {Industries::Trading, kJapaneseTradingBusinessWords},
      }},
 };
+static_assert(kBusinessWords.is_complete());
 
 constexpr auto kEnglishDepartments = std::to_array<std::string_view>({
     "Accounting & Finance",
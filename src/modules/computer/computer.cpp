@@ -6,10 +6,21 @@
 
 #include "faker/computer.h"
 
-#include <format>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <random>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <tuple>
 #include <utility>
 
 #include "business_data.h"
@@ -20,6 +31,7 @@
 #include "random_helper.h"
 #include "string_helper.h"
 #include "validation.h"
+#include "wildcard_pattern.h"
 
 namespace faker::computer {
 
@@ -52,61 +64,361 @@ static std::string get_username() {
 
     std::string_view username;
     switch (selected_name_language) {
-    case Languages::English: username = pick_one(person::kEnglishSocialNetworkId).translation; break;
+    case Languages::English: username = pick_one(person::kEnglishSocialNetworkIdPool).translation; break;
     case Languages::SimplifiedChinese:
-        username = pick_one(person::kSimplifiedChineseSocialNetworkId).translation;
+        username = pick_one(person::kSimplifiedChineseSocialNetworkIdPool).translation;
         break;
     case Languages::TraditionalChinese:
-        username = pick_one(person::kTraditionalChineseSocialNetworkId).translation;
+        username = pick_one(person::kTraditionalChineseSocialNetworkIdPool).translation;
         break;
-    case Languages::Japanese: username = pick_one(person::kJapaneseSocialNetworkId).translation; break;
+    case Languages::Japanese: username = pick_one(person::kJapaneseSocialNetworkIdPool).translation; break;
     }
     return std::string(username);
 }
 
-std::string ip_address(const IpAddressType ip_address_type) {
+// Get a file name without extension
+static std::string get_file_name() {
+    const auto file_name_format    = pick_one(kFileNameFormats);
+    const auto file_name_main_part = pick_one(kFileNameMainParts);
+    return WildcardPattern().append_placeholder(file_name_format, file_name_main_part).expand();
+}
+
+// Longest IPv6 text, plus room for the 3-byte writes of the last IPv4 octet.
+constexpr std::size_t kIpAddressBufferSize = 48;
+
+// Decimal text of every byte value, the last char is the length.
+constexpr auto kDecimalBytes = [] {
+    std::array<std::array<char, 4>, 256> bytes{};
+    for (std::size_t i = 0; i < bytes.size(); ++i) {
+        const auto hundreds = static_cast<char>('0' + i / 100);
+        const auto tens     = static_cast<char>('0' + i / 10 % 10);
+        const auto ones     = static_cast<char>('0' + i % 10);
+        if (i >= 100) {
+            bytes[i] = {hundreds, tens, ones, 3};
+        } else if (i >= 10) {
+            bytes[i] = {tens, ones, '\0', 2};
+        } else {
+            bytes[i] = {ones, '\0', '\0', 1};
+        }
+    }
+    return bytes;
+}();
+
+// Each octet is copied as 3 bytes and the pointer advanced by its length, so `out` needs 2 spare bytes at the end.
+static char* write_ipv4(char* out, const std::uint32_t address) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        const auto& octet = kDecimalBytes[address >> shift & 0xFF];
+        std::memcpy(out, octet.data(), 3);
+        out += octet[3];
+        *out++ = '.';
+    }
+    return out - 1;
+}
+
+static char* write_ipv6(char* out, const std::uint64_t high, const std::uint64_t low, const bool compress) {
+    std::array<std::uint16_t, 8> groups{};
+    for (std::size_t i = 0; i < 4; ++i) {
+        groups[i]     = static_cast<std::uint16_t>(high >> (48 - 16 * i));
+        groups[i + 4] = static_cast<std::uint16_t>(low >> (48 - 16 * i));
+    }
+
+    if (!compress) {
+        for (const std::uint16_t group : groups) {
+            out    = write_hex_bytes(out, group, 2);
+            *out++ = ':';
+        }
+        return out - 1;
+    }
+
+    // RFC 5952: the longest run of two or more zero groups becomes "::", the first one on ties.
+    std::size_t zero_start  = groups.size();
+    std::size_t zero_length = 1;
+    for (std::size_t i = 0; i < groups.size();) {
+        std::size_t length = 0;
+        while (i + length < groups.size() && groups[i + length] == 0) { ++length; }
+        if (length > zero_length) {
+            zero_start  = i;
+            zero_length = length;
+        }
+        i += length + 1;
+    }
+
+    for (std::size_t i = 0; i < groups.size();) {
+        if (i == zero_start) {
+            *out++ = ':';
+            *out++ = ':';
+            i += zero_length;
+            continue;
+        }
+        if (i != 0 && i != zero_start + zero_length) { *out++ = ':'; }
+        out = std::to_chars(out, out + 4, groups[i], 16).ptr;
+        ++i;
+    }
+    return out;
+}
+
+// Host bits of a block, as the masks of the high and low words.
+static std::pair<std::uint64_t, std::uint64_t> host_masks(const IpBlock& block) {
+    constexpr std::uint64_t kAllBits = ~std::uint64_t{0};
+    if (block.type == IpAddressType::IPv4) {
+        return {0, block.prefix_length >= 32 ? 0 : 0xFFFFFFFF >> block.prefix_length};
+    }
+    if (block.prefix_length >= 128) { return {0, 0}; }
+    if (block.prefix_length >= 64) { return {0, kAllBits >> (block.prefix_length - 64)}; }
+    return {kAllBits >> block.prefix_length, kAllBits};
+}
+
+static bool contains(const IpBlock& block, const std::uint64_t high, const std::uint64_t low) {
+    const auto [host_high, host_low] = host_masks(block);
+    return (high & ~host_high) == block.high && (low & ~host_low) == block.low;
+}
+
+static bool parse_ipv4(std::string_view text, std::uint32_t& address) {
+    address = 0;
+    for (int i = 0; i < 4; ++i) {
+        unsigned int octet  = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), octet);
+        if (error != std::errc{} || octet > 255) { return false; }
+        address = address << 8 | octet;
+        text.remove_prefix(static_cast<std::size_t>(end - text.data()));
+        if (i == 3) { break; }
+        if (text.empty() || text.front() != '.') { return false; }
+        text.remove_prefix(1);
+    }
+    return text.empty();
+}
+
+// Parse ':'-separated hex groups, returns the group count or -1.
+static int parse_ipv6_groups(std::string_view text, std::uint16_t* groups, const int max_groups) {
+    int count = 0;
+    while (!text.empty()) {
+        unsigned int group      = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), group, 16);
+        if (error != std::errc{} || end - text.data() > 4 || count == max_groups) { return -1; }
+        groups[count++] = static_cast<std::uint16_t>(group);
+        text.remove_prefix(static_cast<std::size_t>(end - text.data()));
+        if (text.empty()) { break; }
+        if (text.front() != ':' || text.size() == 1) { return -1; }
+        text.remove_prefix(1);
+    }
+    return count;
+}
+
+static bool parse_ipv6(const std::string_view text, std::uint64_t& high, std::uint64_t& low) {
+    std::array<std::uint16_t, 8> groups{};
+
+    const std::size_t gap = text.find("::");
+    if (gap == std::string_view::npos) {
+        if (parse_ipv6_groups(text, groups.data(), 8) != 8) { return false; }
+    } else {
+        const std::string_view head = text.substr(0, gap);
+        const std::string_view tail = text.substr(gap + 2);
+        if (tail.find("::") != std::string_view::npos) { return false; }
+
+        std::array<std::uint16_t, 8> tail_groups{};
+        const int                    head_count = parse_ipv6_groups(head, groups.data(), 7);
+        const int                    tail_count = parse_ipv6_groups(tail, tail_groups.data(), 7);
+        if (head_count < 0 || tail_count < 0 || head_count + tail_count > 7) { return false; }
+        std::copy_n(tail_groups.begin(), tail_count, groups.end() - tail_count);
+    }
+
+    high = 0;
+    low  = 0;
+    for (std::size_t i = 0; i < 4; ++i) {
+        high = high << 16 | groups[i];
+        low  = low << 16 | groups[i + 4];
+    }
+    return true;
+}
+
+// Parse "a.b.c.d/n" or "x:x::x/n". Host bits are cleared.
+static IpBlock parse_cidr(const std::string_view cidr) {
+    const auto invalid = [&] {
+        throw_exception<std::invalid_argument>("Invalid CIDR: '" + std::string(cidr) + "'.");
+    };
+
+    const std::size_t slash = cidr.find('/');
+    if (slash == std::string_view::npos) { invalid(); }
+
+    const std::string_view prefix = cidr.substr(slash + 1);
+    unsigned int           prefix_length = 0;
+    const auto [end, error] = std::from_chars(prefix.data(), prefix.data() + prefix.size(), prefix_length);
+    if (error != std::errc{} || end != prefix.data() + prefix.size()) { invalid(); }
+
+    IpBlock                block{};
+    const std::string_view address = cidr.substr(0, slash);
+    if (address.find(':') == std::string_view::npos) {
+        std::uint32_t ipv4 = 0;
+        if (prefix_length > 32 || !parse_ipv4(address, ipv4)) { invalid(); }
+        block = {IpAddressType::IPv4, 0, ipv4, prefix_length};
+    } else {
+        std::uint64_t high = 0;
+        std::uint64_t low  = 0;
+        if (prefix_length > 128 || !parse_ipv6(address, high, low)) { invalid(); }
+        block = {IpAddressType::IPv6, high, low, prefix_length};
+    }
+
+    const auto [host_high, host_low] = host_masks(block);
+    block.high &= ~host_high;
+    block.low &= ~host_low;
+    return block;
+}
+
+// Draws addresses from a block, set up once per call so that a batch pays for the reserved ranges only once.
+struct IpAddressSampler {
+    IpBlock                  block;
+    std::uint64_t            host_high = 0;
+    std::uint64_t            host_low  = 0;
+    bool                     compress  = false;
+    std::span<const IpBlock> reserved_blocks;
+    std::uint32_t            excluded_mask = 0;  // Bit i set: reserved_blocks[i] is inside the block and excluded.
+};
+
+// Only the reserved blocks inside `block` are kept for the rejection loop. The reserved blocks are disjoint CIDR
+// blocks, so each one is either inside `block`, around it, or apart from it.
+static IpAddressSampler
+    make_ip_address_sampler(const IpBlock& block, const IpAddressOptions options, const std::string_view cidr = {}) {
+    IpAddressSampler sampler{block};
+    std::tie(sampler.host_high, sampler.host_low) = host_masks(block);
+    sampler.compress = has_flag(options, IpAddressOptions::CompressIPv6);
+    if (!has_flag(options, IpAddressOptions::ExcludeReserved)) { return sampler; }
+
+    if (block.type == IpAddressType::IPv4) {
+        sampler.reserved_blocks = kReservedIpv4Blocks;
+    } else {
+        sampler.reserved_blocks = kReservedIpv6Blocks;
+    }
+
+    double reserved_fraction = 0;
+    for (std::size_t i = 0; i < sampler.reserved_blocks.size(); ++i) {
+        const IpBlock& reserved = sampler.reserved_blocks[i];
+        if (reserved.prefix_length <= block.prefix_length && contains(reserved, block.high, block.low)) {
+            reserved_fraction = 1;
+            break;
+        }
+        if (reserved.prefix_length > block.prefix_length && contains(block, reserved.high, reserved.low)) {
+            reserved_fraction += std::ldexp(1.0, static_cast<int>(block.prefix_length - reserved.prefix_length));
+            sampler.excluded_mask |= std::uint32_t{1} << i;
+        }
+    }
+    if (reserved_fraction >= 1) {
+        throw_exception<std::invalid_argument>("Invalid CIDR: '" + std::string(cidr) + "' is reserved.");
+    }
+    return sampler;
+}
+
+// Draw an address and write it, returns the text length. `out` needs kIpAddressBufferSize bytes.
+static std::size_t
+    write_random_ip_address(char* out, const IpAddressSampler& sampler, std::mt19937_64& random_engine) {
+    const IpBlock& block       = sampler.block;
+    const auto     is_excluded = [&](const std::uint64_t high, const std::uint64_t low) {
+        for (std::uint32_t mask = sampler.excluded_mask; mask != 0; mask &= mask - 1) {
+            if (contains(sampler.reserved_blocks[static_cast<std::size_t>(std::countr_zero(mask))], high, low)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::uint64_t high = 0;
+    std::uint64_t low  = 0;
+    do {
+        if (block.type == IpAddressType::IPv6) { high = block.high | (random_engine() & sampler.host_high); }
+        low = block.low | (random_engine() & sampler.host_low);
+    } while (is_excluded(high, low));
+
+    if (block.type == IpAddressType::IPv4) {
+        return static_cast<std::size_t>(write_ipv4(out, static_cast<std::uint32_t>(low)) - out);
+    }
+    return static_cast<std::size_t>(write_ipv6(out, high, low, sampler.compress) - out);
+}
+
+static std::string random_ip_address(const IpAddressSampler& sampler) {
+    char              address[kIpAddressBufferSize];
+    const std::size_t size = write_random_ip_address(address, sampler, get_random_engine());
+    return {address, size};
+}
+
+static std::size_t write_random_ip_addresses(
+    const std::span<char>   buffer,
+    const std::size_t       count,
+    const IpAddressSampler& sampler,
+    const char              delimiter
+) {
     std::mt19937_64& random_engine = get_random_engine();
 
-    if (ip_address_type == IpAddressType::IPv4) {
-        std::uniform_int_distribution distribution(0, 255);
-        return std::to_string(distribution(random_engine)) +
-               "." +
-               std::to_string(distribution(random_engine)) +
-               "." +
-               std::to_string(distribution(random_engine)) +
-               "." +
-               std::to_string(distribution(random_engine));
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        char              address[kIpAddressBufferSize];
+        const std::size_t size = write_random_ip_address(address, sampler, random_engine);
+        if (buffer.size() - offset < size + 1) { break; }
+        std::memcpy(buffer.data() + offset, address, size);
+        offset += size;
+        buffer[offset++] = delimiter;
     }
+    return offset;
+}
 
-    std::uniform_int_distribution distribution(0, 0xffff);
-    return std::format(
-        "{:04x}:{:04x}:{:04x}:{:04x}:{:04x}:{:04x}:{:04x}:{:04x}",
-        distribution(random_engine),
-        distribution(random_engine),
-        distribution(random_engine),
-        distribution(random_engine),
-        distribution(random_engine),
-        distribution(random_engine),
-        distribution(random_engine),
-        distribution(random_engine)
-    );
+static const IpBlock& address_space(const IpAddressType ip_address_type) {
+    return ip_address_type == IpAddressType::IPv4 ? kIpv4AddressSpace : kIpv6AddressSpace;
+}
+
+std::string ip_address(const IpAddressType ip_address_type, const IpAddressOptions options) {
+    return random_ip_address(make_ip_address_sampler(address_space(ip_address_type), options));
+}
+
+std::string ip_address(const std::string_view cidr, const IpAddressOptions options) {
+    return random_ip_address(make_ip_address_sampler(parse_cidr(cidr), options, cidr));
+}
+
+std::size_t ip_addresses(
+    const std::span<char>  buffer,
+    const std::size_t      count,
+    const IpAddressType    ip_address_type,
+    const IpAddressOptions options,
+    const char             delimiter
+) {
+    const IpAddressSampler sampler = make_ip_address_sampler(address_space(ip_address_type), options);
+    return write_random_ip_addresses(buffer, count, sampler, delimiter);
+}
+
+std::size_t ip_addresses(
+    const std::span<char>  buffer,
+    const std::size_t      count,
+    const std::string_view cidr,
+    const IpAddressOptions options,
+    const char             delimiter
+) {
+    const IpAddressSampler sampler = make_ip_address_sampler(parse_cidr(cidr), options, cidr);
+    return write_random_ip_addresses(buffer, count, sampler, delimiter);
+}
+
+// A locally administered unicast address: bit 1 of the first byte set, bit 0 cleared.
+static char* write_mac_address(char* out, const std::uint64_t random_word) {
+    const std::uint64_t address = (random_word & 0xFEFFFFFFFFFF) | 0x020000000000;
+    for (int shift = 40; shift >= 0; shift -= 8) {
+        out    = write_hex_bytes(out, address >> shift, 1);
+        *out++ = ':';
+    }
+    return out - 1;
 }
 
 std::string mac_address() {
-    std::mt19937_64&              random_engine = get_random_engine();
-    std::uniform_int_distribution distribution(0, 255);
-
-    const unsigned int rand_byte = distribution(random_engine);
-    auto               mac0      = static_cast<unsigned char>(rand_byte & 0xFE | 0x02);
-    return std::format(
-        "{:02x}:{:02x}:{:02x}:{:02x}:{:02x}:{:02x}",
-        mac0,
-        distribution(random_engine),
-        distribution(random_engine),
-        distribution(random_engine),
-        distribution(random_engine),
-        distribution(random_engine)
-    );
+    std::string result(17, '\0');
+    write_mac_address(result.data(), get_random_engine()());
+    return result;
+}
+
+std::size_t mac_addresses(const std::span<char> buffer, const std::size_t count, const char delimiter) {
+    std::mt19937_64& random_engine = get_random_engine();
+
+    const std::size_t fitting = std::min(count, buffer.size() / 18);
+    char*             out     = buffer.data();
+    for (std::size_t i = 0; i < fitting; ++i) {
+        out    = write_mac_address(out, random_engine());
+        *out++ = delimiter;
+    }
+    return fitting * 18;
 }
 
 std::string
@@ -132,15 +444,13 @@ std::string
     std::string       extension;
     if (extensions.empty()) {
         const auto selected_file_type = pick_file_type();
-        folder_path                   = base_path + separator + std::string(kFoldersMap.at(selected_file_type));
+        folder_path                   = base_path + separator + std::string(kFoldersMap[selected_file_type]);
     } else {
         // Get extension
         auto extensions_vector  = split_and_trim(extensions, delimiter);
         extension               = pick_one<std::string>(extensions_vector);
-        const auto extension_it = kExtensionsMap.find(extension);
-        const auto file_type    = extension_it == kExtensionsMap.end() ? FileTypes::Other : extension_it->second;
-        const auto folder_it    = kFoldersMap.find(file_type);
-        const auto folder       = folder_it == kFoldersMap.end() ? "" : folder_it->second;
+        const FileTypes* extension_type = kExtensionsMap.find(extension);
+        const auto       folder         = kFoldersMap[extension_type == nullptr ? FileTypes::Other : *extension_type];
         if (folder.empty()) {
             folder_path = base_path + separator + extension;
         } else {
@@ -148,11 +458,7 @@ std::string
         }
     }
 
-    const auto file_name_format    = pick_one(kFileNameFormats);
-    const auto file_name_main_part = pick_one(kFileNameMainParts);
-    const auto file_name =
-        replace_wildcard_to_letter(replace_wildcard_to_digit(replace_placeholder(file_name_format, file_name_main_part))
-        );
+    const auto file_name = get_file_name();
 
     if (extensions.empty()) { return folder_path + separator + file_name; }
 
@@ -179,9 +485,7 @@ std::string file_directory(const OperatingSystems operating_systems) {
     const std::string base_path   = replace_placeholder(path_format, username);
     std::string       folder_path = base_path;
     const auto        file_type   = pick_file_type();
-    const auto        folder_it   = kFoldersMap.find(file_type);
-    const auto        folder      = folder_it == kFoldersMap.end() ? "" : folder_it->second;
-    folder_path                   = base_path + separator + std::string(folder);
+    folder_path                   = base_path + separator + std::string(kFoldersMap[file_type]);
 
     return folder_path;
 }
@@ -193,11 +497,7 @@ std::string file_name(const std::string_view extensions, const char delimiter) {
         auto extensions_vector = split_and_trim(extensions, delimiter);
         extension              = pick_one<std::string>(extensions_vector);
     }
-    const auto file_name_format    = pick_one(kFileNameFormats);
-    const auto file_name_main_part = pick_one(kFileNameMainParts);
-    auto       file_name =
-        replace_wildcard_to_letter(replace_wildcard_to_digit(replace_placeholder(file_name_format, file_name_main_part))
-        );
+    auto file_name = get_file_name();
     if (extensions.empty()) { return file_name; }
     return file_name + "." + extension;
 }
@@ -294,16 +594,14 @@ void File::roll() {
     std::string       extension;
     if (extensions_.empty()) {
         const auto selected_file_type = pick_file_type();
-        folder_path                   = base_path + separator + std::string(kFoldersMap.at(selected_file_type));
+        folder_path                   = base_path + separator + std::string(kFoldersMap[selected_file_type]);
         extension                     = "";
     } else {
         // Get extension
         auto extensions_vector  = split_and_trim(std::string(extensions_), delimiter_);
         extension               = pick_one<std::string>(extensions_vector);
-        const auto extension_it = kExtensionsMap.find(extension);
-        const auto file_type    = extension_it == kExtensionsMap.end() ? FileTypes::Other : extension_it->second;
-        const auto folder_it    = kFoldersMap.find(file_type);
-        const auto folder       = folder_it == kFoldersMap.end() ? "" : folder_it->second;
+        const FileTypes* extension_type = kExtensionsMap.find(extension);
+        const auto       folder         = kFoldersMap[extension_type == nullptr ? FileTypes::Other : *extension_type];
         if (folder.empty()) {
             folder_path = base_path + separator + extension;
         } else {
@@ -311,11 +609,7 @@ void File::roll() {
         }
     }
 
-    const auto file_name_format    = pick_one(kFileNameFormats);
-    const auto file_name_main_part = pick_one(kFileNameMainParts);
-    const auto file_name =
-        replace_wildcard_to_letter(replace_wildcard_to_digit(replace_placeholder(file_name_format, file_name_main_part))
-        );
+    const auto file_name = get_file_name();
 
     if (extensions_.empty()) {
         path_ = folder_path + separator + file_name;
@@ -8,8 +8,13 @@
 #define FAKER_COMPUTER_DATA_H
 
 #include <array>
+#include <cstdint>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
+
+#include "enum_table.h"
+#include "faker/types/enums.h"
+#include "perfect_hash_map.h"
 
 namespace faker::computer {
 
@@ -30,7 +35,7 @@ enum class FileTypes {
     Other
 };
 
-const std::unordered_map<FileTypes, std::string_view> kFoldersMap = {
+constexpr EnumTable<FileTypes, std::string_view, 14> kFoldersMap = {
     {FileTypes::Application, "apps"},
     {FileTypes::Archive, "archives"},
     {FileTypes::Audio, "audio"},
@@ -46,6 +51,7 @@ const std::unordered_map<FileTypes, std::string_view> kFoldersMap = {
     {FileTypes::Video, "video"},
     {FileTypes::Other, ""}
 };
+static_assert(kFoldersMap.is_complete());
 
 constexpr auto kWindowsPathFormats = std::to_array<std::string_view>({
     R"(C:\{})",
@@ -103,7 +109,7 @@ constexpr auto kFileNameFormats = std::to_array<std::string_view>({
     "{}_@@####",
 });
 
-const std::unordered_map<std::string_view, FileTypes> kExtensionsMap = {
+constexpr PerfectHashMap kExtensionsMap(std::to_array<std::pair<std::string_view, FileTypes>>({
     // Application
     {"app", FileTypes::Application},
     {"lnk", FileTypes::Application},
@@ -244,7 +250,6 @@ const std::unordered_map<std::string_view, FileTypes> kExtensionsMap = {
     {"lock", FileTypes::Temporary},
     {"pid", FileTypes::Temporary},
     {"sav", FileTypes::Temporary},
-    {"bak", FileTypes::Temporary},
 
     // Video
     {"mp4", FileTypes::Video},
@@ -255,9 +260,53 @@ const std::unordered_map<std::string_view, FileTypes> kExtensionsMap = {
     {"flv", FileTypes::Video},
     {"m4v", FileTypes::Video},
     {"ts", FileTypes::Video},
+}));
 
+/// @brief An IPv4 or IPv6 CIDR block, IPv4 addresses are kept in the low 32 bits of `low`.
+struct IpBlock {
+    IpAddressType type;
+    std::uint64_t high;
+    std::uint64_t low;
+    unsigned      prefix_length;
 };
 
+constexpr IpBlock kIpv4AddressSpace = {IpAddressType::IPv4, 0, 0, 0};
+constexpr IpBlock kIpv6AddressSpace = {IpAddressType::IPv6, 0, 0, 0};
+
+// IPv4 special-purpose address registry (RFC 6890 and updates), without overlaps
+constexpr auto kReservedIpv4Blocks = std::to_array<IpBlock>({
+    {IpAddressType::IPv4, 0, 0x00000000, 8},   // 0.0.0.0/8, this network
+    {IpAddressType::IPv4, 0, 0x0A000000, 8},   // 10.0.0.0/8, private
+    {IpAddressType::IPv4, 0, 0x64400000, 10},  // 100.64.0.0/10, shared address space
+    {IpAddressType::IPv4, 0, 0x7F000000, 8},   // 127.0.0.0/8, loopback
+    {IpAddressType::IPv4, 0, 0xA9FE0000, 16},  // 169.254.0.0/16, link local
+    {IpAddressType::IPv4, 0, 0xAC100000, 12},  // 172.16.0.0/12, private
+    {IpAddressType::IPv4, 0, 0xC0000000, 24},  // 192.0.0.0/24, IETF protocol assignments
+    {IpAddressType::IPv4, 0, 0xC0000200, 24},  // 192.0.2.0/24, documentation (TEST-NET-1)
+    {IpAddressType::IPv4, 0, 0xC0586300, 24},  // 192.88.99.0/24, 6to4 relay anycast
+    {IpAddressType::IPv4, 0, 0xC0A80000, 16},  // 192.168.0.0/16, private
+    {IpAddressType::IPv4, 0, 0xC6120000, 15},  // 198.18.0.0/15, benchmarking
+    {IpAddressType::IPv4, 0, 0xC6336400, 24},  // 198.51.100.0/24, documentation (TEST-NET-2)
+    {IpAddressType::IPv4, 0, 0xCB007100, 24},  // 203.0.113.0/24, documentation (TEST-NET-3)
+    {IpAddressType::IPv4, 0, 0xE0000000, 4},   // 224.0.0.0/4, multicast
+    {IpAddressType::IPv4, 0, 0xF0000000, 4},   // 240.0.0.0/4, reserved and limited broadcast
+});
+
+// IPv6 special-purpose address registry (RFC 6890 and updates), without overlaps
+constexpr auto kReservedIpv6Blocks = std::to_array<IpBlock>({
+    {IpAddressType::IPv6, 0x0000000000000000, 0x0000000000000000, 128},  // ::/128, unspecified
+    {IpAddressType::IPv6, 0x0000000000000000, 0x0000000000000001, 128},  // ::1/128, loopback
+    {IpAddressType::IPv6, 0x0000000000000000, 0x0000FFFF00000000, 96},   // ::ffff:0:0/96, IPv4-mapped
+    {IpAddressType::IPv6, 0x0064FF9B00000000, 0x0000000000000000, 96},   // 64:ff9b::/96, IPv4-IPv6 translation
+    {IpAddressType::IPv6, 0x0100000000000000, 0x0000000000000000, 64},   // 100::/64, discard-only
+    {IpAddressType::IPv6, 0x2001000000000000, 0x0000000000000000, 23},   // 2001::/23, IETF protocol assignments
+    {IpAddressType::IPv6, 0x20010DB800000000, 0x0000000000000000, 32},   // 2001:db8::/32, documentation
+    {IpAddressType::IPv6, 0x2002000000000000, 0x0000000000000000, 16},   // 2002::/16, 6to4
+    {IpAddressType::IPv6, 0xFC00000000000000, 0x0000000000000000, 7},    // fc00::/7, unique local
+    {IpAddressType::IPv6, 0xFE80000000000000, 0x0000000000000000, 10},   // fe80::/10, link local
+    {IpAddressType::IPv6, 0xFF00000000000000, 0x0000000000000000, 8},    // ff00::/8, multicast
+});
+
 }  // namespace faker::computer
 
 #endif  // FAKER_COMPUTER_DATA_H
@@ -6,17 +6,31 @@
 
 #include "faker/datetime.h"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
 #include <iomanip>
 #include <locale>
+#include <numbers>
 #include <random>
 #include <regex>
 #include <source_location>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
+#include "civil_calendar.h"
+#include "date_time_format.h"
+#include "distributions.h"
+#include "faker/internal/symbol_source.h"
 #include "faker/types/enums.h"
 #include "random_engine.h"
 #include "validation.h"
@@ -28,20 +42,16 @@ static std::string g_time_format = "%H:%M:%S";
 
 enum class DateTimeFlag { Date, Time };
 
-static std::tm now() {
-    const std::time_t now = std::time(nullptr);
-    return *std::localtime(&now);
-}
-
 // Parse date string to tm
 static std::tm parse_time(
     const std::string&          dt,
     const DateTimeFlag          dt_flag,
     const std::source_location& location = std::source_location::current()
 ) {
+    // A time of day is checked on 1970-01-01, no timezone is involved.
     std::tm tm{};
-    tm          = now();
-    tm.tm_isdst = -1;
+    tm.tm_year = 70;
+    tm.tm_mday = 1;
 
     std::string_view format = g_time_format;
 
@@ -69,124 +79,212 @@ static std::tm parse_time(
     return tm;
 }
 
-// Check if the given tm is in the allowed weekday
-static bool is_allowed_weekday(const std::tm& tm, const DaysOfWeek allowed) {
-    static constexpr DaysOfWeek mapping[] = {
-        DaysOfWeek::Sunday,
-        DaysOfWeek::Monday,
-        DaysOfWeek::Tuesday,
-        DaysOfWeek::Wednesday,
-        DaysOfWeek::Thursday,
-        DaysOfWeek::Friday,
-        DaysOfWeek::Saturday,
-    };
-    return (allowed & mapping[tm.tm_wday]) != static_cast<DaysOfWeek>(0);
+// Check if the given weekday, 0 for Sunday, is in the allowed days of the week
+static bool is_allowed_weekday(const int weekday, const DaysOfWeek allowed) {
+    return (static_cast<int>(allowed) >> weekday & 1) != 0;
 }
 
-// Format date tm to string
-static std::string format_time(const std::tm& tm, const DateTimeFlag dt_flag) {
-    std::ostringstream     stream;
-    const std::string_view format = dt_flag == DateTimeFlag::Date ? g_date_format : g_time_format;
-    stream << std::put_time(&tm, std::string(format).c_str());
-    return stream.str();
-}
+// The formats compiled once, see DateTimeFormat
+static const DateTimeFormat g_date_formatter(g_date_format);
+static const DateTimeFormat g_time_formatter(g_time_format);
+static const DateTimeFormat g_datetime_formatter(g_date_format + " " + g_time_format);
 
-static std::string get_date(
-    const std::string_view      start,
-    const std::string_view      end,
-    const DaysOfWeek            days_of_week,
+// Parse a date string to days since 1970-01-01
+static std::int64_t parse_days(
+    const std::string_view      dt,
     const std::source_location& location = std::source_location::current()
 ) {
-    auto start_tm = parse_time(std::string(start), DateTimeFlag::Date, location);
-    auto end_tm   = parse_time(std::string(end), DateTimeFlag::Date, location);
+    const std::tm tm = parse_time(std::string(dt), DateTimeFlag::Date, location);
+    return days_from_civil(
+        tm.tm_year + std::int64_t{1900},
+        static_cast<unsigned>(tm.tm_mon + 1),
+        static_cast<unsigned>(tm.tm_mday)
+    );
+}
 
-    const auto start_date = std::mktime(&start_tm);
-    const auto end_date   = std::mktime(&end_tm);
+DateRange::DateRange(
+    const std::string_view start_date,
+    const std::string_view end_date,
+    const DaysOfWeek       days_of_week
+) :
+    days_of_week_(days_of_week) {
+    CHECK_EMPTY(std::invalid_argument, start_date);
+    CHECK_EMPTY(std::invalid_argument, end_date);
 
-    CHECK_RANGE_EX(std::invalid_argument, start_date, end_date, location);
+    const std::int64_t start_day = parse_days(start_date);
+    const std::int64_t end_day   = parse_days(end_date);
+    check_range<std::invalid_argument, std::int64_t>(start_day, "start_date", end_day, "end_date");
 
-    constexpr std::time_t seconds_per_day = 24 * 3600;
-    const auto            span_days       = static_cast<int>((end_date - start_date) / seconds_per_day) + 1;
+    start_day_ = start_day;
+    day_count_ = end_day - start_day + 1;
 
-    std::mt19937_64& random_engine = get_random_engine();
+    // Every week from the first day has the same allowed offsets, the last partial week has those below its size.
+    for (int offset = 0; offset < 7; ++offset) {
+        if (is_allowed_weekday(weekday_of(offset), days_of_week)) {
+            allowed_offsets_[allowed_per_week_++] = static_cast<std::uint8_t>(offset);
+        }
+    }
+    allowed_day_count_ = day_count_ / 7 * allowed_per_week_;
+    for (unsigned k = 0; k < allowed_per_week_ && allowed_offsets_[k] < day_count_ % 7; ++k) { ++allowed_day_count_; }
+    if (allowed_day_count_ == 0) {
+        throw_exception<std::invalid_argument>(
+            "No matching weekday in range '" + std::string(start_date) + "' to '" + std::string(end_date) + "'."
+        );
+    }
+}
 
-    // If span_days < 7, we can use a simple loop to find a valid date
-    if (span_days < 7) {
-        std::vector<std::time_t> candidates;
-        candidates.reserve(span_days);
+int DateRange::weekday_of(const std::int64_t day) const {
+    return static_cast<int>(weekday_from_days(start_day_ + day));
+}
 
-        for (int i = 0; i < span_days; ++i) {
-            std::time_t tt = start_date + i * seconds_per_day;
-            if (std::tm tm = *std::localtime(&tt); is_allowed_weekday(tm, days_of_week)) { candidates.push_back(tt); }
-        }
+std::int64_t DateRange::day_count() const {
+    return day_count_;
+}
 
-        if (candidates.empty()) {
-            throw_exception<std::invalid_argument>(
-                "No matching weekday in range '" + std::string(start) + "' to '" + std::string(end) + "'.",
-                location
-            );
-        }
+std::int64_t DateRange::allowed_day_count() const {
+    return allowed_day_count_;
+}
 
-        std::uniform_int_distribution<size_t> distribution(0, candidates.size() - 1);
-        const std::tm                         random_tm = *std::localtime(&candidates[distribution(random_engine)]);
-        return format_time(random_tm, DateTimeFlag::Date);
-    }
-
-    // If span_days >= 7
-    std::uniform_int_distribution distribution(start_date, end_date);
-    const auto                    random_time = distribution(random_engine);
-    const std::tm                 random_tm   = *std::localtime(&random_time);
-    if (is_allowed_weekday(random_tm, days_of_week)) { return format_time(random_tm, DateTimeFlag::Date); }
-    for (int offset = 1; offset < span_days; ++offset) {
-        // try forward
-        std::time_t forward = random_time + offset * seconds_per_day;
-        if (forward <= end_date) {
-            std::tm tm_forward = *std::localtime(&forward);
-            if (is_allowed_weekday(tm_forward, days_of_week)) { return format_time(tm_forward, DateTimeFlag::Date); }
-        }
-        // try backward
-        std::time_t backward = random_time - offset * seconds_per_day;
-        if (backward >= start_date) {
-            std::tm tm_backward = *std::localtime(&backward);
-            if (is_allowed_weekday(tm_backward, days_of_week)) { return format_time(tm_backward, DateTimeFlag::Date); }
-        }
+DaysOfWeek DateRange::days_of_week() const {
+    return days_of_week_;
+}
+
+TimeRange::TimeRange(const std::string_view start_time, const std::string_view end_time) {
+    CHECK_EMPTY(std::invalid_argument, start_time);
+    CHECK_EMPTY(std::invalid_argument, end_time);
+
+    const auto seconds_since_midnight = [](const std::tm& tm) {
+        return tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+    };
+    const int start_second = seconds_since_midnight(parse_time(std::string(start_time), DateTimeFlag::Time));
+    const int end_second   = seconds_since_midnight(parse_time(std::string(end_time), DateTimeFlag::Time));
+    check_range<std::invalid_argument>(start_second, "start_time", end_second, "end_time");
+
+    start_second_ = start_second;
+    end_second_   = end_second;
+}
+
+int TimeRange::second_count() const {
+    return end_second_ - start_second_ + 1;
+}
+
+std::int64_t DateRange::day_at(const std::int64_t index) const {
+    // Map the index to its week and its offset in the week.
+    return start_day_ + index / allowed_per_week_ * 7 + allowed_offsets_[index % allowed_per_week_];
+}
+
+std::int64_t DateRange::random_day() const {
+    std::mt19937_64&                            random_engine = get_random_engine();
+    std::uniform_int_distribution<std::int64_t> distribution(0, allowed_day_count_ - 1);
+    return day_at(distribution(random_engine));
+}
+
+void DateRange::check_nanosecond_range() const {
+    // The first and last days whose nanoseconds since 1970-01-01 all fit in 64 bits.
+    constexpr std::int64_t kFirstDay = -106'751;
+    constexpr std::int64_t kLastDay  = 106'750;
+    if (start_day_ < kFirstDay || start_day_ + day_count_ - 1 > kLastDay) {
+        throw_exception<std::invalid_argument>(
+            "Invalid argument: nanosecond timestamps must be between 1677-09-22 and 2262-04-10. (Current: " +
+            g_date_formatter.format({start_day_, 0, 0}) + " to " +
+            g_date_formatter.format({start_day_ + day_count_ - 1, 0, 0}) + ")"
+        );
     }
+}
 
-    throw_exception<std::runtime_error>("Unable to find a valid weekday in the expanded search.", location);
+std::uint32_t TimeRange::random_second() const {
+    std::mt19937_64&                   random_engine = get_random_engine();
+    std::uniform_int_distribution<int> distribution(start_second_, end_second_);
+    return static_cast<std::uint32_t>(distribution(random_engine));
 }
 
-std::string get_time(
-    const std::string_view      start,
-    const std::string_view      end,
-    const std::source_location& location = std::source_location::current()
-) {
-    auto start_tm = parse_time(std::string(start), DateTimeFlag::Time, location);
-    auto end_tm   = parse_time(std::string(end), DateTimeFlag::Time, location);
+std::string date(const DateRange& range) {
+    return g_date_formatter.format({range.random_day(), 0, 0});
+}
 
-    const auto start_time = std::mktime(&start_tm);
-    const auto end_time   = std::mktime(&end_tm);
+std::string time(const TimeRange& range) {
+    return g_time_formatter.format({0, range.random_second(), 0});
+}
 
-    CHECK_RANGE_EX(std::invalid_argument, start_time, end_time, location);
+std::string datetime(const DateRange& date_range, const TimeRange& time_range) {
+    return g_datetime_formatter.format({date_range.random_day(), time_range.random_second(), 0});
+}
 
-    std::mt19937_64&              random_engine = get_random_engine();
-    std::uniform_int_distribution distribution(start_time, end_time);
-    const auto                    random_time = distribution(random_engine);
-    const std::tm                 random_tm   = *std::localtime(&random_time);
+constexpr std::int64_t kSecondsPerDay        = 86'400;
+constexpr std::int64_t kNanosecondsPerSecond = 1'000'000'000;
+constexpr std::int64_t kNanosecondsPerDay    = kSecondsPerDay * kNanosecondsPerSecond;
 
-    return format_time(random_tm, DateTimeFlag::Time);
+std::chrono::sys_days date_point(const DateRange& range) {
+    return std::chrono::sys_days(std::chrono::days(range.random_day()));
 }
 
-std::string date(const std::string_view start_date, const std::string_view end_date, const DaysOfWeek days_of_week) {
-    CHECK_EMPTY(std::invalid_argument, start_date);
-    CHECK_EMPTY(std::invalid_argument, end_date);
+std::chrono::seconds time_of_day(const TimeRange& range) {
+    return std::chrono::seconds(range.random_second());
+}
+
+std::chrono::sys_seconds datetime_point(const DateRange& date_range, const TimeRange& time_range) {
+    return std::chrono::sys_seconds(
+        std::chrono::seconds(date_range.random_day() * kSecondsPerDay + time_range.random_second())
+    );
+}
+
+std::chrono::sys_time<std::chrono::nanoseconds>
+    datetime_point_ns(const DateRange& date_range, const TimeRange& time_range) {
+    date_range.check_nanosecond_range();
+    std::mt19937_64&                             random_engine = get_random_engine();
+    std::uniform_int_distribution<std::int64_t> distribution(0, kNanosecondsPerSecond - 1);
+    const std::int64_t seconds = date_range.random_day() * kSecondsPerDay + time_range.random_second();
+    return std::chrono::sys_time<std::chrono::nanoseconds>(
+        std::chrono::nanoseconds(seconds * kNanosecondsPerSecond + distribution(random_engine))
+    );
+}
+
+// The bulk fills draw several days, seconds or nanoseconds from each engine word, see SymbolSource.
+
+void fill_dates(const std::span<std::int64_t> out, const DateRange& range) {
+    std::mt19937_64& random_engine = get_random_engine();
+    SymbolSource     days          = make_symbol_source(static_cast<std::size_t>(range.allowed_day_count_));
+    for (std::int64_t& value : out) {
+        value = range.day_at(static_cast<std::int64_t>(days(random_engine))) * kSecondsPerDay;
+    }
+}
+
+void fill_times(const std::span<std::int64_t> out, const TimeRange& range) {
+    std::mt19937_64& random_engine = get_random_engine();
+    SymbolSource     seconds       = make_symbol_source(static_cast<std::size_t>(range.second_count()));
+    for (std::int64_t& value : out) { value = range.start_second_ + static_cast<std::int64_t>(seconds(random_engine)); }
+}
 
-    return get_date(start_date, end_date, days_of_week);
+void fill_datetimes(const std::span<std::int64_t> out, const DateRange& date_range, const TimeRange& time_range) {
+    std::mt19937_64& random_engine = get_random_engine();
+    SymbolSource     days          = make_symbol_source(static_cast<std::size_t>(date_range.allowed_day_count_));
+    SymbolSource     seconds       = make_symbol_source(static_cast<std::size_t>(time_range.second_count()));
+    for (std::int64_t& value : out) {
+        const std::int64_t day = date_range.day_at(static_cast<std::int64_t>(days(random_engine)));
+        value = day * kSecondsPerDay + time_range.start_second_ + static_cast<std::int64_t>(seconds(random_engine));
+    }
+}
+
+void fill_datetimes_ns(const std::span<std::int64_t> out, const DateRange& date_range, const TimeRange& time_range) {
+    date_range.check_nanosecond_range();
+    std::mt19937_64& random_engine = get_random_engine();
+    SymbolSource     days          = make_symbol_source(static_cast<std::size_t>(date_range.allowed_day_count_));
+    SymbolSource     seconds       = make_symbol_source(static_cast<std::size_t>(time_range.second_count()));
+    SymbolSource     nanoseconds   = make_symbol_source(static_cast<std::size_t>(kNanosecondsPerSecond));
+    for (std::int64_t& value : out) {
+        const std::int64_t day    = date_range.day_at(static_cast<std::int64_t>(days(random_engine)));
+        const std::int64_t second = time_range.start_second_ + static_cast<std::int64_t>(seconds(random_engine));
+        value = (day * kSecondsPerDay + second) * kNanosecondsPerSecond +
+                static_cast<std::int64_t>(nanoseconds(random_engine));
+    }
+}
+
+std::string date(const std::string_view start_date, const std::string_view end_date, const DaysOfWeek days_of_week) {
+    return date(DateRange(start_date, end_date, days_of_week));
 }
 
 std::string time(const std::string_view start_time, const std::string_view end_time) {
-    CHECK_EMPTY(std::invalid_argument, start_time);
-    CHECK_EMPTY(std::invalid_argument, end_time);
-    return get_time(start_time, end_time);
+    return time(TimeRange(start_time, end_time));
 }
 
 std::string datetime(
@@ -196,12 +294,245 @@ std::string datetime(
     const std::string_view end_time,
     const DaysOfWeek       days_of_week
 ) {
-    CHECK_EMPTY(std::invalid_argument, start_date);
-    CHECK_EMPTY(std::invalid_argument, end_date);
-    CHECK_EMPTY(std::invalid_argument, start_time);
-    CHECK_EMPTY(std::invalid_argument, end_time);
+    return datetime(DateRange(start_date, end_date, days_of_week), TimeRange(start_time, end_time));
+}
+
+// The diurnal rate is constant over each of these slots of the day, 84.375 seconds long.
+constexpr std::size_t  kDiurnalSlots       = 1024;
+constexpr std::int64_t kNanosecondsPerSlot = kNanosecondsPerDay / static_cast<std::int64_t>(kDiurnalSlots);
+static_assert(kNanosecondsPerSlot * static_cast<std::int64_t>(kDiurnalSlots) == kNanosecondsPerDay);
+
+// Throw if an option is out of range, `requirement` reads as "must be <requirement>".
+static void check_option(
+    const bool             is_valid,
+    const std::string_view name,
+    const double           value,
+    const std::string_view requirement
+) {
+    if (!is_valid) {
+        throw_exception<std::invalid_argument>(
+            "Invalid argument: '" + std::string(name) + "' must be " + std::string(requirement) +
+            ". (Current: " + std::to_string(value) + ")"
+        );
+    }
+}
+
+// SplitMix64 finalizer, spreads the seed and chunk index over all the bits of the engine seed.
+static std::uint64_t mix_seed(std::uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EB;
+    return x ^ (x >> 31);
+}
+
+// Split nanoseconds since the epoch into the fields a format reads.
+static DateTimeValue to_date_time_value(const std::int64_t ns) {
+    std::int64_t days = ns / kNanosecondsPerDay;
+    std::int64_t rest = ns % kNanosecondsPerDay;
+    if (rest < 0) {
+        --days;
+        rest += kNanosecondsPerDay;
+    }
+    return {
+        days,
+        static_cast<std::uint32_t>(rest / kNanosecondsPerSecond),
+        static_cast<std::uint32_t>(rest % kNanosecondsPerSecond),
+    };
+}
+
+// The compiled ISO 8601 format of each fraction precision.
+static const DateTimeFormat& iso_format(const unsigned int fraction_digits) {
+    static const std::array<DateTimeFormat, 10> formats = {
+        DateTimeFormat("%Y-%m-%dT%H:%M:%SZ"),
+        DateTimeFormat("%Y-%m-%dT%H:%M:%S.%1fZ"),
+        DateTimeFormat("%Y-%m-%dT%H:%M:%S.%2fZ"),
+        DateTimeFormat("%Y-%m-%dT%H:%M:%S.%3fZ"),
+        DateTimeFormat("%Y-%m-%dT%H:%M:%S.%4fZ"),
+        DateTimeFormat("%Y-%m-%dT%H:%M:%S.%5fZ"),
+        DateTimeFormat("%Y-%m-%dT%H:%M:%S.%6fZ"),
+        DateTimeFormat("%Y-%m-%dT%H:%M:%S.%7fZ"),
+        DateTimeFormat("%Y-%m-%dT%H:%M:%S.%8fZ"),
+        DateTimeFormat("%Y-%m-%dT%H:%M:%S.%9fZ"),
+    };
+    check_option(fraction_digits <= 9, "fraction_digits", fraction_digits, "in [0, 9]");
+    return formats[fraction_digits];
+}
+
+EventTimeSequence::EventTimeSequence(
+    const std::int64_t     start_ns,
+    const EventTimeOptions options,
+    const std::uint64_t    seed,
+    const std::uint64_t    first_chunk
+) :
+    options_(options),
+    start_ns_(start_ns),
+    seed_(seed) {
+    const double rate = options.events_per_second;
+    check_option(rate > 0 && std::isfinite(rate), "events_per_second", rate, "greater than 0");
+    check_option(
+        options.diurnal_amplitude >= 0 && options.diurnal_amplitude <= 1,
+        "diurnal_amplitude",
+        options.diurnal_amplitude,
+        "in [0, 1]"
+    );
+    check_option(
+        options.diurnal_peak_hour >= 0 && options.diurnal_peak_hour < 24,
+        "diurnal_peak_hour",
+        options.diurnal_peak_hour,
+        "in [0, 24)"
+    );
+    check_option(options.burst_factor >= 1, "burst_factor", options.burst_factor, "at least 1");
+    check_option(options.mean_burst_seconds > 0, "mean_burst_seconds", options.mean_burst_seconds, "greater than 0");
+    check_option(options.mean_calm_seconds > 0, "mean_calm_seconds", options.mean_calm_seconds, "greater than 0");
+    check_option(
+        options.chunk_nanoseconds > 0,
+        "chunk_nanoseconds",
+        static_cast<double>(options.chunk_nanoseconds),
+        "greater than 0"
+    );
+
+    mean_gap_ns_ = 1e9 / rate;
+
+    if (options.process == ArrivalProcess::Diurnal) {
+        // The mean of 1 + a cos(theta) over a slot, so that each slot gets exactly its share of the cycle.
+        constexpr double kRadiansPerSlot = 2 * std::numbers::pi / kDiurnalSlots;
+        const double     peak_slot       = options.diurnal_peak_hour / 24 * kDiurnalSlots;
+        slot_gap_ns_.resize(kDiurnalSlots);
+        for (std::size_t i = 0; i < kDiurnalSlots; ++i) {
+            const double begin         = (static_cast<double>(i) - peak_slot) * kRadiansPerSlot;
+            const double mean_cosine   = (std::sin(begin + kRadiansPerSlot) - std::sin(begin)) / kRadiansPerSlot;
+            const double relative_rate = 1 + options.diurnal_amplitude * mean_cosine;
+            // At full amplitude the trough slot still has a tiny positive rate, which only means a very long gap.
+            slot_gap_ns_[i] = mean_gap_ns_ / std::max(relative_rate, 1e-12);
+        }
+    }
 
-    return get_date(start_date, end_date, days_of_week) + " " + get_time(start_time, end_time);
+    // The calm rate is chosen so that the long-run rate is `events_per_second`.
+    const double cycle_seconds = options.mean_burst_seconds + options.mean_calm_seconds;
+    const double calm_rate     = rate * cycle_seconds /
+                             (options.mean_calm_seconds + options.burst_factor * options.mean_burst_seconds);
+    calm_gap_ns_       = 1e9 / calm_rate;
+    burst_gap_ns_      = calm_gap_ns_ / options.burst_factor;
+    burst_probability_ = options.mean_burst_seconds / cycle_seconds;
+
+    start_chunk(first_chunk);
+    advance();
+}
+
+void EventTimeSequence::start_chunk(const std::uint64_t index) {
+    chunk_          = index;
+    chunk_start_ns_ = start_ns_ + static_cast<std::int64_t>(index) * options_.chunk_nanoseconds;
+    offset_ns_      = 0;
+    engine_.seed(mix_seed(seed_ ^ mix_seed(index + 0x9E3779B97F4A7C15)));
+
+    if (options_.process == ArrivalProcess::Diurnal) {
+        const std::int64_t time_of_day = (chunk_start_ns_ % kNanosecondsPerDay + kNanosecondsPerDay) %
+                                         kNanosecondsPerDay;
+        const std::int64_t slot        = time_of_day / kNanosecondsPerSlot;
+        slot_                          = static_cast<std::size_t>(slot);
+        switch_offset_ns_              = static_cast<double>((slot + 1) * kNanosecondsPerSlot - time_of_day);
+    } else if (options_.process == ArrivalProcess::Bursty) {
+        in_burst_         = uniform_open_closed(engine_) <= burst_probability_;
+        switch_offset_ns_ = standard_exponential(engine_) * 1e9 *
+                            (in_burst_ ? options_.mean_burst_seconds : options_.mean_calm_seconds);
+    }
+}
+
+double EventTimeSequence::next_offset() {
+    switch (options_.process) {
+    case ArrivalProcess::Poisson: return offset_ns_ + standard_exponential(engine_) * mean_gap_ns_;
+    case ArrivalProcess::Diurnal: {
+        double offset = offset_ns_;
+        while (true) {
+            const double gap = standard_exponential(engine_) * slot_gap_ns_[slot_];
+            if (offset + gap < switch_offset_ns_) { return offset + gap; }
+            // The slot ends before the next arrival, which is drawn again at the rate of the next slot.
+            offset = switch_offset_ns_;
+            slot_  = (slot_ + 1) % kDiurnalSlots;
+            switch_offset_ns_ += static_cast<double>(kNanosecondsPerSlot);
+            if (offset >= static_cast<double>(options_.chunk_nanoseconds)) { return offset; }
+        }
+    }
+    case ArrivalProcess::Bursty: {
+        double offset = offset_ns_;
+        while (true) {
+            const double gap = standard_exponential(engine_) * (in_burst_ ? burst_gap_ns_ : calm_gap_ns_);
+            if (offset + gap < switch_offset_ns_) { return offset + gap; }
+            // The state changes before the next arrival, which is drawn again at the new rate.
+            offset            = switch_offset_ns_;
+            in_burst_         = !in_burst_;
+            switch_offset_ns_ = offset + standard_exponential(engine_) * 1e9 *
+                                             (in_burst_ ? options_.mean_burst_seconds : options_.mean_calm_seconds);
+            if (offset >= static_cast<double>(options_.chunk_nanoseconds)) { return offset; }
+        }
+    }
+    }
+    return offset_ns_;
+}
+
+void EventTimeSequence::advance() {
+    while (true) {
+        offset_ns_ = next_offset();
+        if (offset_ns_ < static_cast<double>(options_.chunk_nanoseconds)) {
+            pending_ns_ = chunk_start_ns_ + static_cast<std::int64_t>(offset_ns_);
+            return;
+        }
+        start_chunk(chunk_ + 1);
+    }
+}
+
+std::uint64_t EventTimeSequence::chunk() const {
+    return chunk_;
+}
+
+std::int64_t EventTimeSequence::next_ns() {
+    const std::int64_t event = pending_ns_;
+    advance();
+    return event;
+}
+
+std::int64_t EventTimeSequence::next_ms() {
+    const std::int64_t ns = next_ns();
+    return ns / 1'000'000 - (ns % 1'000'000 < 0 ? 1 : 0);
+}
+
+std::string EventTimeSequence::next_iso(const unsigned int fraction_digits) {
+    const DateTimeFormat& format = iso_format(fraction_digits);
+    return format.format(to_date_time_value(next_ns()));
+}
+
+void EventTimeSequence::fill_ns(const std::span<std::int64_t> out) {
+    for (std::int64_t& value : out) { value = next_ns(); }
+}
+
+void EventTimeSequence::fill_ms(const std::span<std::int64_t> out) {
+    for (std::int64_t& value : out) { value = next_ms(); }
+}
+
+std::size_t EventTimeSequence::write_iso(
+    const std::span<char> buffer,
+    const std::size_t     count,
+    const unsigned int    fraction_digits,
+    const char            delimiter
+) {
+    const DateTimeFormat& format = iso_format(fraction_digits);
+    char*                 out    = buffer.data();
+    char* const           end    = out + buffer.size();
+    std::array<char, 64>  scratch{};
+    for (std::size_t i = 0; i < count; ++i) {
+        // Write in place when the widest string fits, otherwise measure it first.
+        const DateTimeValue value = to_date_time_value(pending_ns_);
+        if (static_cast<std::size_t>(end - out) > format.max_size()) {
+            out += format.write(out, value);
+        } else {
+            const std::size_t size = format.write(scratch.data(), value);
+            if (static_cast<std::size_t>(end - out) < size + 1) { break; }
+            std::memcpy(out, scratch.data(), size);
+            out += size;
+        }
+        *out++ = delimiter;
+        advance();
+    }
+    return static_cast<std::size_t>(out - buffer.data());
 }
 
 }  // namespace faker::datetime
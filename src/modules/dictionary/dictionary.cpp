@@ -0,0 +1,221 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file dictionary.cpp
+
+#include "faker/dictionary.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "business_data.h"
+#include "faker/internal/symbol_source.h"
+#include "faker/types/enums.h"
+#include "person_data.h"
+#include "product_data.h"
+#include "random_engine.h"
+#include "string_pool.h"
+#include "validation.h"
+
+namespace faker::dictionary {
+
+// Every table must be indexable by a token ID, the name tables are the largest.
+template <typename... Tables>
+static constexpr bool fit_token_ids(const Tables&... tables) {
+    return ((tables.size() <= std::size_t{std::numeric_limits<TokenId>::max()} + 1) && ...);
+}
+static_assert(fit_token_ids(
+    person::kEnglishMaleFirstNamePool,
+    person::kEnglishFemaleFirstNamePool,
+    person::kEnglishLastNamePool,
+    person::kSimplifiedChineseMaleFirstNamePool,
+    person::kSimplifiedChineseFemaleFirstNamePool,
+    person::kSimplifiedChineseLastNamePool,
+    person::kTraditionalChineseMaleFirstNamePool,
+    person::kTraditionalChineseFemaleFirstNamePool,
+    person::kTraditionalChineseLastNamePool,
+    person::kJapaneseMaleFirstNamePool,
+    person::kJapaneseFemaleFirstNamePool,
+    person::kJapaneseLastNamePool
+));
+
+Dictionary::Dictionary() = default;
+
+Dictionary::Dictionary(const std::span<const std::string_view> values) : values_(values) {}
+
+Dictionary::Dictionary(
+    const std::span<const std::uint32_t> original_refs,
+    const char* const                    original_chars,
+    const std::span<const std::uint32_t> translation_refs,
+    const char* const                    translation_chars
+) :
+    original_refs_(original_refs),
+    translation_refs_(translation_refs),
+    original_chars_(original_chars),
+    translation_chars_(translation_chars) {}
+
+std::size_t Dictionary::size() const {
+    return original_refs_.empty() ? values_.size() : original_refs_.size();
+}
+
+std::string_view Dictionary::operator[](const TokenId token_id) const {
+    return original_refs_.empty() ? values_[token_id] : pooled_string(original_chars_, original_refs_[token_id]);
+}
+
+std::string_view Dictionary::translation(const TokenId token_id) const {
+    return original_refs_.empty() ? values_[token_id] : pooled_string(translation_chars_, translation_refs_[token_id]);
+}
+
+// The dictionary of a BilingualPool, the only way to build one from a pool.
+template <typename Pool>
+Dictionary pooled_dictionary(const Pool& pool) {
+    return {pool.original_refs(), pool.original_chars(), pool.translation_refs(), pool.translation_chars()};
+}
+
+// The table a field is picked from, for one language and gender.
+static Dictionary get_table(const DictionaryFields field, const Languages language, const Genders gender) {
+    switch (field) {
+    case DictionaryFields::FirstName:
+        if (gender == Genders::M) {
+            switch (language) {
+            case Languages::English           : return pooled_dictionary(person::kEnglishMaleFirstNamePool);
+            case Languages::SimplifiedChinese : return pooled_dictionary(person::kSimplifiedChineseMaleFirstNamePool);
+            case Languages::TraditionalChinese: return pooled_dictionary(person::kTraditionalChineseMaleFirstNamePool);
+            case Languages::Japanese          : return pooled_dictionary(person::kJapaneseMaleFirstNamePool);
+            }
+        }
+        switch (language) {
+        case Languages::English           : return pooled_dictionary(person::kEnglishFemaleFirstNamePool);
+        case Languages::SimplifiedChinese : return pooled_dictionary(person::kSimplifiedChineseFemaleFirstNamePool);
+        case Languages::TraditionalChinese: return pooled_dictionary(person::kTraditionalChineseFemaleFirstNamePool);
+        case Languages::Japanese          : return pooled_dictionary(person::kJapaneseFemaleFirstNamePool);
+        }
+        break;
+    case DictionaryFields::LastName:
+        switch (language) {
+        case Languages::English           : return pooled_dictionary(person::kEnglishLastNamePool);
+        case Languages::SimplifiedChinese : return pooled_dictionary(person::kSimplifiedChineseLastNamePool);
+        case Languages::TraditionalChinese: return pooled_dictionary(person::kTraditionalChineseLastNamePool);
+        case Languages::Japanese          : return pooled_dictionary(person::kJapaneseLastNamePool);
+        }
+        break;
+    case DictionaryFields::Gender: return Dictionary(person::kGenders[language].values());
+    case DictionaryFields::Title:
+        if (gender == Genders::M) {
+            switch (language) {
+            case Languages::English           : return Dictionary(person::kEnglishMaleTitle);
+            case Languages::SimplifiedChinese : return Dictionary(person::kSimplifiedChineseMaleTitle);
+            case Languages::TraditionalChinese: return Dictionary(person::kTraditionalChineseMaleTitle);
+            case Languages::Japanese          : return Dictionary(person::kJapaneseMaleTitle);
+            }
+        }
+        switch (language) {
+        case Languages::English           : return Dictionary(person::kEnglishFemaleTitle);
+        case Languages::SimplifiedChinese : return Dictionary(person::kSimplifiedChineseFemaleTitle);
+        case Languages::TraditionalChinese: return Dictionary(person::kTraditionalChineseFemaleTitle);
+        case Languages::Japanese          : return Dictionary(person::kJapaneseFemaleTitle);
+        }
+        break;
+    case DictionaryFields::MaritalStatus:
+        switch (language) {
+        case Languages::English           : return Dictionary(person::kEnglishMaritalStatus);
+        case Languages::SimplifiedChinese : return Dictionary(person::kSimplifiedChineseMaritalStatus);
+        case Languages::TraditionalChinese: return Dictionary(person::kTraditionalChineseMaritalStatus);
+        case Languages::Japanese          : return Dictionary(person::kJapaneseMaritalStatus);
+        }
+        break;
+    case DictionaryFields::JobTitle:
+        switch (language) {
+        case Languages::English           : return Dictionary(person::kEnglishJobTitle);
+        case Languages::SimplifiedChinese : return Dictionary(person::kSimplifiedChineseJobTitle);
+        case Languages::TraditionalChinese: return Dictionary(person::kTraditionalChineseJobTitle);
+        case Languages::Japanese          : return Dictionary(person::kJapaneseJobTitle);
+        }
+        break;
+    case DictionaryFields::Department:
+        switch (language) {
+        case Languages::English           : return Dictionary(business::kEnglishDepartments);
+        case Languages::SimplifiedChinese : return Dictionary(business::kSimplifiedChineseDepartments);
+        case Languages::TraditionalChinese: return Dictionary(business::kTraditionalChineseDepartments);
+        case Languages::Japanese          : return Dictionary(business::kJapaneseDepartments);
+        }
+        break;
+    case DictionaryFields::Industry: return Dictionary(business::kIndustries[language].values());
+    case DictionaryFields::ProductCategory:
+        switch (language) {
+        case Languages::English           : return Dictionary(product::kEnglishProductCategories);
+        case Languages::SimplifiedChinese : return Dictionary(product::kSimplifiedChineseProductCategories);
+        case Languages::TraditionalChinese: return Dictionary(product::kTraditionalChineseProductCategories);
+        case Languages::Japanese          : return Dictionary(product::kJapaneseProductCategories);
+        }
+        break;
+    case DictionaryFields::Color:
+        switch (language) {
+        case Languages::English           : return Dictionary(product::kEnglishColors);
+        case Languages::SimplifiedChinese : return Dictionary(product::kSimplifiedChineseColors);
+        case Languages::TraditionalChinese: return Dictionary(product::kTraditionalChineseColors);
+        case Languages::Japanese          : return Dictionary(product::kJapaneseColors);
+        }
+        break;
+    }
+    return {};
+}
+
+static Dictionary get_checked(const DictionaryFields field, const Languages language, const Genders gender) {
+    if (!std::has_single_bit(static_cast<unsigned>(language))) {
+        throw_exception<std::invalid_argument>(
+            "Invalid argument: 'language' must be a single language. (Current: " +
+            std::to_string(static_cast<int>(language)) +
+            ")"
+        );
+    }
+    if (!std::has_single_bit(static_cast<unsigned>(gender))) {
+        throw_exception<std::invalid_argument>(
+            "Invalid argument: 'gender' must be a single gender. (Current: " +
+            std::to_string(static_cast<int>(gender)) +
+            ")"
+        );
+    }
+    // A value that is not an enumerator has no table, and an empty dictionary cannot be sampled.
+    Dictionary dictionary = get_table(field, language, gender);
+    if (dictionary.size() == 0) {
+        throw_exception<std::invalid_argument>(
+            "Invalid argument: no values for this field and language. (Current: field " +
+            std::to_string(static_cast<int>(field)) +
+            ", language " +
+            std::to_string(static_cast<int>(language)) +
+            ")"
+        );
+    }
+    return dictionary;
+}
+
+Dictionary get(const DictionaryFields field, const Languages language, const Genders gender) {
+    return get_checked(field, language, gender);
+}
+
+TokenId token_id(const DictionaryFields field, const Languages language, const Genders gender) {
+    const std::size_t size = get_checked(field, language, gender).size();
+    return static_cast<TokenId>(std::uniform_int_distribution<std::size_t>(0, size - 1)(get_random_engine()));
+}
+
+void fill_token_ids(
+    const std::span<TokenId> token_ids,
+    const DictionaryFields   field,
+    const Languages          language,
+    const Genders            gender
+) {
+    std::mt19937_64& engine = get_random_engine();
+    SymbolSource     source = make_symbol_source(get_checked(field, language, gender).size());
+    for (TokenId& id : token_ids) { id = static_cast<TokenId>(source(engine)); }
+}
+
+}  // namespace faker::dictionary
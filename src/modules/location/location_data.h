@@ -7,16 +7,52 @@
 #ifndef FAKER_LOCATION_DATA_H
 #define FAKER_LOCATION_DATA_H
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
 #include <string_view>
-#include <unordered_map>
-#include <vector>
 
+#include "enum_table.h"
 #include "faker/types/bilingual.h"
 #include "faker/types/enums.h"
 
 namespace faker::location {
 
+// Administrative levels of an address, stored in place so that the address tables are constant data.
+class AdminLevels {
+public:
+    static constexpr std::size_t kCapacity = 4;
+
+    constexpr AdminLevels() = default;
+
+    constexpr AdminLevels(const std::initializer_list<BilingualView> levels) : size_(levels.size()) {
+        if (levels.size() > kCapacity) { throw std::logic_error("AdminLevels: too many levels."); }
+        std::ranges::copy(levels, levels_.begin());
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const {
+        return size_;
+    }
+
+    constexpr const BilingualView& operator[](const std::size_t level) const {
+        return levels_[level];
+    }
+
+    [[nodiscard]] constexpr const BilingualView* begin() const {
+        return levels_.data();
+    }
+
+    [[nodiscard]] constexpr const BilingualView* end() const {
+        return levels_.data() + size_;
+    }
+
+private:
+    std::array<BilingualView, kCapacity> levels_{};
+    std::size_t                          size_ = 0;
+};
+
 struct AddressComponents {
     // US: ZIP code/ZIP+4 code, UK: postcode(upper case), CN: postcode, JP:postal code
     std::string_view           postcode;
@@ -24,14 +60,14 @@ struct AddressComponents {
     // admin_level2:  US: city, UK: locality(only if required), CN: prefecture city, JP: municipal-level subdivision
     // admin_level3:  CN: county/area/district
     // admin_level4:  CN: town/street
-    std::vector<BilingualView> admin_levels;
+    AdminLevels                admin_levels;
     // US: street name and house number, UK: street name and street number, CN: road, JP: land-lot
     BilingualView              street;
     // US: apartment/suite/room number (if any), CN: building and room number, JP: secondary unit
     BilingualView              building;
 };
 
-const std::unordered_map<CountryCodesStandard, std::unordered_map<Regions, std::string_view>>
+constexpr EnumTable<CountryCodesStandard, EnumTable<Regions, std::string_view, 4>, 3>
     kRegionsByCountryCodesStandards = {
         {CountryCodesStandard::None,
          {
@@ -55,8 +91,9 @@ const std::unordered_map<CountryCodesStandard, std::unordered_map<Regions, std::
              {Regions::Japan, "JPN"},
          }},
 };
+static_assert(kRegionsByCountryCodesStandards.is_complete());
 
-const std::unordered_map<Languages, std::unordered_map<Regions, std::string_view>> kRegions = {
+constexpr EnumTable<Languages, EnumTable<Regions, std::string_view, 4>, 4> kRegions = {
     {Languages::English,
      {
          {Regions::UnitedStates, "United States"},
@@ -88,6 +125,7 @@ const std::unordered_map<Languages, std::unordered_map<Regions, std::string_view
         },
     }
 };
+static_assert(kRegions.is_complete());
 
 constexpr int KUnitedStatesCityLevel  = 1;
 constexpr int KUnitedKingdomCityLevel = 0;
@@ -98,7 +136,7 @@ constexpr int KJapanCityLevel         = 0;
 // #: Represents a digit
 // @: Represents an uppercase letter
 // clang-format off
-const auto kUnitedStatesAddressComponents = std::to_array<AddressComponents>({
+constexpr auto kUnitedStatesAddressComponents = std::to_array<AddressComponents>({
     // State: California
     {"90210-####", {{"CA", "CA"}, {"Beverly Hills", "Beverly Hills"}}, {"#### Santa Monica Blvd", "#### Santa Monica Blvd"}, {}},
     {"90012-####", {{"CA", "CA"}, {"Los Angeles", "Los Angeles"}}, {"### N Spring St", "### N Spring St"}, {"Apt ###", "Apt ###"}},
@@ -296,7 +334,7 @@ const auto kUnitedStatesAddressComponents = std::to_array<AddressComponents>({
 
 });
 
-const auto kUnitedKingdomAddressComponents = std::to_array<AddressComponents>({
+constexpr auto kUnitedKingdomAddressComponents = std::to_array<AddressComponents>({
     // Location: London (England)
     {"SW1A 0AA", {{"LONDON", "LONDON"}}, {"10 Downing Street", "10 Downing Street"}, {}},
     {"SW1A #@@", {{"LONDON", "LONDON"}}, {"## Parliament Street", "## Parliament Street"}, {}},
@@ -508,7 +546,7 @@ const auto kUnitedKingdomAddressComponents = std::to_array<AddressComponents>({
 
 });
 
-const auto kChinaAddressComponents = std::to_array<AddressComponents>({
+constexpr auto kChinaAddressComponents = std::to_array<AddressComponents>({
     // City: Beijing (北京市) - Municipality (Corrected by you)
     {"100006", {{}, {"北京市", "Beijing"}, {"东城区", "Dongcheng District"}, {"东华门街道", "Donghuamen Subdistrict"}}, {"东安门大街##号", "No. ## Dong'anmen Street"}, {"#号院#楼###室", "Courtyard #, Bldg #, Rm ###"}},
     {"100005", {{}, {"北京市", "Beijing"}, {"东城区", "Dongcheng District"}, {"建国门街道", "Jianguomen Subdistrict"}}, {"赵堂子胡同##号", "No. ## Zhaotangzi Hutong"}, {}},
@@ -700,7 +738,7 @@ const auto kChinaAddressComponents = std::to_array<AddressComponents>({
     {"150020", {{"黑龙江省", "Heilongjiang Province"}, {"哈尔滨市", "Harbin City"}, {"道外区", "Daowai District"}, {"靖宇街道", "Jingyu Subdistrict"}}, {"南二道街##号", "No. ## South 2nd Street"}, {}},
 });
 
-const auto kJapanAddressComponents = std::to_array<AddressComponents>({
+constexpr auto kJapanAddressComponents = std::to_array<AddressComponents>({
     // Prefecture: Tōkyō-to (東京都)
     // City: Chiyoda-ku (千代田区)
     {"100-0005", {{"東京都", "Tōkyō-to"}, {"千代田区", "Chiyoda-ku"}}, {"丸の内#-##-##", "#-##-##, Marunouchi"}, {"丸の内ビルディング##階", "Marunouchi Building, Fl. ##"}},
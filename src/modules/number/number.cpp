@@ -6,28 +6,57 @@
 
 #include "faker/number.h"
 
+#include <array>
+#include <charconv>
+#include <cmath>
 #include <concepts>
-#include <iomanip>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <random>
-#include <sstream>
+#include <source_location>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
+#include "distributions.h"
 #include "random_engine.h"
 #include "validation.h"
 
 namespace faker::number {
 
-// Generate a random decimal string.
-static std::string GetDecimalString(
+// Powers of ten that are exact as double, 10^22 is the largest one.
+constexpr auto kPowersOfTen = [] {
+    std::array<double, 23> powers{};
+    double                 power = 1;
+    for (double& p : powers) {
+        p = power;
+        power *= 10;
+    }
+    return powers;
+}();
+
+static double power_of_ten(const int exponent) {
+    const auto index = static_cast<std::size_t>(exponent);
+    return index < kPowersOfTen.size() ? kPowersOfTen[index] : std::pow(10.0, exponent);
+}
+
+detail::DecimalScale detail::scale_decimal_range(
     const double                start,
     const double                end,
     const int                   decimal_places,
-    const std::source_location& location = std::source_location::current()
+    const std::source_location& location
 ) {
-    std::mt19937_64& rng = get_random_engine();
+    // Scaled bounds must fit in int64_t, 2^63 itself does not.
+    constexpr double kScaledLimit = 9223372036854775808.0;
 
-    const double factor       = std::pow(10, decimal_places);
-    const auto   scaled_start = static_cast<int64_t>(std::ceil(start * factor));
-    const auto   scaled_end   = static_cast<int64_t>(std::floor(end * factor));
+    CHECK_RANGE_EX(std::invalid_argument, 0, decimal_places, location);
+
+    const double factor       = power_of_ten(decimal_places);
+    const double scaled_start = std::ceil(start * factor);
+    const double scaled_end   = std::floor(end * factor);
 
     if (scaled_start > scaled_end) {
         throw_exception<std::invalid_argument>(
@@ -35,13 +64,48 @@ static std::string GetDecimalString(
             location
         );
     }
+    if (scaled_start < -kScaledLimit || scaled_end >= kScaledLimit) {
+        throw_exception<std::invalid_argument>("Range is too large for the specified decimal_places.", location);
+    }
+
+    return {static_cast<std::int64_t>(scaled_start), static_cast<std::int64_t>(scaled_end), factor};
+}
+
+// Draw a random decimal as an integer count of 10^-decimal_places units.
+static std::int64_t random_scaled_decimal(
+    const double                start,
+    const double                end,
+    const int                   decimal_places,
+    const std::source_location& location
+) {
+    const detail::DecimalScale    scale = detail::scale_decimal_range(start, end, decimal_places, location);
+    std::uniform_int_distribution dist(scale.start, scale.end);
+    return dist(get_random_engine());
+}
+
+// Format a count of 10^-decimal_places units, inserting the decimal point into its digits.
+static std::string format_scaled_decimal(const std::int64_t scaled_value, const int decimal_places) {
+    char       digits[24];
+    const auto magnitude  = scaled_value < 0 ? 0 - static_cast<std::uint64_t>(scaled_value)
+                                             : static_cast<std::uint64_t>(scaled_value);
+    const auto digit_size = static_cast<std::size_t>(std::to_chars(digits, std::end(digits), magnitude).ptr - digits);
+
+    // At least one digit before the decimal point, leading zeros are written by the constructor.
+    const auto        places     = static_cast<std::size_t>(decimal_places);
+    const std::size_t sign_size  = scaled_value < 0 ? 1 : 0;
+    const std::size_t int_size   = digit_size > places ? digit_size - places : 1;
+    const std::size_t point_size = places > 0 ? 1 : 0;
 
-    std::uniform_int_distribution dist(scaled_start, scaled_end);
-    const int64_t                 raw_value = dist(rng);
+    std::string result(sign_size + int_size + point_size + places, '0');
+    char*       out = result.data();
+    if (sign_size != 0) { *out++ = '-'; }
 
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(decimal_places) << static_cast<double>(raw_value) / factor;
-    return oss.str();
+    const std::size_t int_digits = digit_size > places ? int_size : 0;
+    std::memcpy(out + int_size - int_digits, digits, int_digits);
+    out += int_size;
+    if (point_size != 0) { *out++ = '.'; }
+    std::memcpy(out + places - (digit_size - int_digits), digits + int_digits, digit_size - int_digits);
+    return result;
 }
 
 template <std::integral T>
@@ -79,7 +143,10 @@ T decimal(T start, T end, const int decimal_places) {
     CHECK_RANGE_T(std::invalid_argument, T, start, end);
     CHECK_RANGE(std::invalid_argument, 0, decimal_places);
 
-    return static_cast<T>(std::stod(GetDecimalString(start, end, decimal_places)));
+    const auto location = std::source_location::current();
+    return static_cast<T>(
+        static_cast<double>(random_scaled_decimal(start, end, decimal_places, location)) / power_of_ten(decimal_places)
+    );
 }
 template float       number::decimal<float>(float, float, int);
 template double      number::decimal<double>(double, double, int);
@@ -90,10 +157,156 @@ std::string decimal_string(T start, T end, const int decimal_places) {
     CHECK_RANGE_T(std::invalid_argument, T, start, end);
     CHECK_RANGE(std::invalid_argument, 0, decimal_places);
 
-    return GetDecimalString(start, end, decimal_places);
+    const auto location = std::source_location::current();
+    return format_scaled_decimal(random_scaled_decimal(start, end, decimal_places, location), decimal_places);
 }
 template std::string number::decimal_string<float>(float, float, int);
 template std::string number::decimal_string<double>(double, double, int);
 template std::string number::decimal_string<long double>(long double, long double, int);
 
+template <typename T>
+void detail::check_fill_range(const T start, const T end, const std::source_location& location) {
+    CHECK_RANGE_T_EX(std::invalid_argument, T, start, end, location);
+}
+template void detail::check_fill_range<int8_t>(int8_t, int8_t, const std::source_location&);
+template void detail::check_fill_range<int16_t>(int16_t, int16_t, const std::source_location&);
+template void detail::check_fill_range<int32_t>(int32_t, int32_t, const std::source_location&);
+template void detail::check_fill_range<int64_t>(int64_t, int64_t, const std::source_location&);
+template void detail::check_fill_range<uint8_t>(uint8_t, uint8_t, const std::source_location&);
+template void detail::check_fill_range<uint16_t>(uint16_t, uint16_t, const std::source_location&);
+template void detail::check_fill_range<uint32_t>(uint32_t, uint32_t, const std::source_location&);
+template void detail::check_fill_range<uint64_t>(uint64_t, uint64_t, const std::source_location&);
+template void detail::check_fill_range<float>(float, float, const std::source_location&);
+template void detail::check_fill_range<double>(double, double, const std::source_location&);
+template void detail::check_fill_range<long double>(long double, long double, const std::source_location&);
+
+// Throw if a distribution parameter is not greater than 0, NaN included. The location is the sampler's, whose name
+// prefixes the message.
+static void check_positive(const double value, const std::string_view name, const std::source_location& location) {
+    if (!(value > 0)) {
+        throw_exception<std::invalid_argument>(
+            "Invalid argument: '" + std::string(name) + "' must be greater than 0. (Current: " + std::to_string(value) +
+                ")",
+            location
+        );
+    }
+}
+
+template <std::floating_point T>
+T normal(const T mean, const T stddev) {
+    const auto location = std::source_location::current();
+    check_positive(static_cast<double>(stddev), "stddev", location);
+
+    return static_cast<T>(mean + stddev * standard_normal(get_random_engine()));
+}
+template float       number::normal<float>(float, float);
+template double      number::normal<double>(double, double);
+template long double number::normal<long double>(long double, long double);
+
+template <std::floating_point T>
+void fill_normal(const std::span<T> out, const std::type_identity_t<T> mean, const std::type_identity_t<T> stddev) {
+    const auto location = std::source_location::current();
+    check_positive(static_cast<double>(stddev), "stddev", location);
+
+    std::mt19937_64& random_engine = get_random_engine();
+    for (T& value : out) { value = static_cast<T>(mean + stddev * standard_normal(random_engine)); }
+}
+template void number::fill_normal<float>(std::span<float>, float, float);
+template void number::fill_normal<double>(std::span<double>, double, double);
+template void number::fill_normal<long double>(std::span<long double>, long double, long double);
+
+template <std::floating_point T>
+T lognormal(const T mu, const T sigma) {
+    const auto location = std::source_location::current();
+    check_positive(static_cast<double>(sigma), "sigma", location);
+
+    return static_cast<T>(std::exp(mu + sigma * standard_normal(get_random_engine())));
+}
+template float       number::lognormal<float>(float, float);
+template double      number::lognormal<double>(double, double);
+template long double number::lognormal<long double>(long double, long double);
+
+template <std::floating_point T>
+void fill_lognormal(const std::span<T> out, const std::type_identity_t<T> mu, const std::type_identity_t<T> sigma) {
+    const auto location = std::source_location::current();
+    check_positive(static_cast<double>(sigma), "sigma", location);
+
+    std::mt19937_64& random_engine = get_random_engine();
+    for (T& value : out) { value = static_cast<T>(std::exp(mu + sigma * standard_normal(random_engine))); }
+}
+template void number::fill_lognormal<float>(std::span<float>, float, float);
+template void number::fill_lognormal<double>(std::span<double>, double, double);
+template void number::fill_lognormal<long double>(std::span<long double>, long double, long double);
+
+template <std::floating_point T>
+T exponential(const T rate) {
+    const auto location = std::source_location::current();
+    check_positive(static_cast<double>(rate), "rate", location);
+
+    return static_cast<T>(standard_exponential(get_random_engine()) / rate);
+}
+template float       number::exponential<float>(float);
+template double      number::exponential<double>(double);
+template long double number::exponential<long double>(long double);
+
+template <std::floating_point T>
+void fill_exponential(const std::span<T> out, const std::type_identity_t<T> rate) {
+    const auto location = std::source_location::current();
+    check_positive(static_cast<double>(rate), "rate", location);
+
+    std::mt19937_64& random_engine = get_random_engine();
+    const T          mean          = 1 / rate;
+    for (T& value : out) { value = static_cast<T>(standard_exponential(random_engine) * mean); }
+}
+template void number::fill_exponential<float>(std::span<float>, float);
+template void number::fill_exponential<double>(std::span<double>, double);
+template void number::fill_exponential<long double>(std::span<long double>, long double);
+
+// A Pareto variate is scale * exp(E / shape) for a standard exponential E, which avoids a pow per draw.
+template <std::floating_point T>
+T pareto(const T scale, const T shape) {
+    const auto location = std::source_location::current();
+    check_positive(static_cast<double>(scale), "scale", location);
+    check_positive(static_cast<double>(shape), "shape", location);
+
+    return static_cast<T>(scale * std::exp(standard_exponential(get_random_engine()) / shape));
+}
+template float       number::pareto<float>(float, float);
+template double      number::pareto<double>(double, double);
+template long double number::pareto<long double>(long double, long double);
+
+template <std::floating_point T>
+void fill_pareto(const std::span<T> out, const std::type_identity_t<T> scale, const std::type_identity_t<T> shape) {
+    const auto location = std::source_location::current();
+    check_positive(static_cast<double>(scale), "scale", location);
+    check_positive(static_cast<double>(shape), "shape", location);
+
+    std::mt19937_64& random_engine = get_random_engine();
+    const T          inverse_shape = 1 / shape;
+    for (T& value : out) {
+        value = static_cast<T>(scale * std::exp(standard_exponential(random_engine) * inverse_shape));
+    }
+}
+template void number::fill_pareto<float>(std::span<float>, float, float);
+template void number::fill_pareto<double>(std::span<double>, double, double);
+template void number::fill_pareto<long double>(std::span<long double>, long double, long double);
+
+std::uint64_t zipf(const std::uint64_t element_count, const double exponent) {
+    const auto location = std::source_location::current();
+    check_positive(static_cast<double>(element_count), "element_count", location);
+    check_positive(exponent, "exponent", location);
+
+    return ZipfSampler(element_count, exponent)(get_random_engine());
+}
+
+void fill_zipf(const std::span<std::uint64_t> out, const std::uint64_t element_count, const double exponent) {
+    const auto location = std::source_location::current();
+    check_positive(static_cast<double>(element_count), "element_count", location);
+    check_positive(exponent, "exponent", location);
+
+    std::mt19937_64&  random_engine = get_random_engine();
+    const ZipfSampler sampler(element_count, exponent);
+    for (std::uint64_t& value : out) { value = sampler(random_engine); }
+}
+
 }  // namespace faker::number
@@ -6,6 +6,7 @@
 
 #include "faker/payment.h"
 
+#include <cstdint>
 #include <iomanip>
 #include <random>
 #include <sstream>
@@ -13,27 +14,26 @@
 #include <string_view>
 #include <vector>
 
+#include "check_digit.h"
+#include "civil_calendar.h"
+#include "date_time_format.h"
 #include "faker/types/enums.h"
 #include "payment_data.h"
 #include "random_engine.h"
 #include "random_helper.h"
 #include "string_helper.h"
 #include "validation.h"
+#include "wildcard_pattern.h"
 
 namespace faker::payment {
 
 static std::string g_card_date_format = "%m/%y";
 
-static std::tm now() {
-    const std::time_t now = std::time(nullptr);
-    return *std::localtime(&now);
-}
-
 static std::tm
     parse_time(const std::string& dt, const std::source_location& location = std::source_location::current()) {
+    // Only the month and year are read, the day is any valid one.
     std::tm tm{};
-    tm          = now();
-    tm.tm_isdst = -1;
+    tm.tm_mday = 1;
 
     const std::string_view format = g_card_date_format;
 
@@ -54,32 +54,28 @@ static std::tm
     return tm;
 }
 
-static std::string format_time(const std::tm& tm) {
-    std::ostringstream     stream;
-    const std::string_view format = g_card_date_format;
-    stream << std::put_time(&tm, std::string(format).c_str());
-    return stream.str();
-}
+// The card date format compiled once, see DateTimeFormat
+static const DateTimeFormat g_card_date_formatter(g_card_date_format);
 
 static std::string get_card_date(
     const std::string_view      start_date,
     const std::string_view      end_date,
     const std::source_location& location = std::source_location::current()
 ) {
-    auto start_tm = parse_time(std::string(start_date));
-    auto end_tm   = parse_time(std::string(end_date));
-
-    const auto start = std::mktime(&start_tm);
-    const auto end   = std::mktime(&end_tm);
+    // Months since January 1900, drawn uniformly. No timezone is involved.
+    const auto months = [](const std::tm& tm) { return tm.tm_year * 12 + tm.tm_mon; };
+    const int  start  = months(parse_time(std::string(start_date)));
+    const int  end    = months(parse_time(std::string(end_date)));
 
     CHECK_RANGE_EX(std::invalid_argument, start, end, location);
 
     std::mt19937_64&              random_engine = get_random_engine();
     std::uniform_int_distribution distribution(start, end);
-    const auto                    random_time = distribution(random_engine);
-    const std::tm                 random_tm   = *std::localtime(&random_time);
+    const int                     random_month = distribution(random_engine);
 
-    return format_time(random_tm);
+    const std::int64_t days =
+        days_from_civil(1900 + random_month / 12, static_cast<unsigned>(random_month % 12 + 1), 1);
+    return g_card_date_formatter.format({days, 0, 0});
 }
 
 std::string payment_method(const std::string_view payment_methods, const char delimiter) {
@@ -91,22 +87,34 @@ std::string payment_method(const std::string_view payment_methods, const char de
 std::string card_type(const Languages languages, const CardTypes card_types) {
     const auto selected_language  = pick_language(languages);
     const auto selected_card_type = pick_card_type(card_types);
-    return std::string(kCardTypes.at(selected_language).at(selected_card_type));
+    return std::string(kCardTypes[selected_language][selected_card_type]);
 }
 
 std::string card_number(const CardTypes card_types) {
     const auto selected_card_type = pick_card_type(card_types);
 
-    std::string_view pattern;
+    const WildcardPattern* pattern = nullptr;
     switch (selected_card_type) {
-    case CardTypes::AmericanExpress: pattern = pick_one(kAmericanExpressCardNumberFormat); break;
-    case CardTypes::JCB            : pattern = pick_one(kJCBCardNumberFormat); break;
-    case CardTypes::MasterCard     : pattern = pick_one(kMasterCardNumberFormat); break;
-    case CardTypes::UnionPay       : pattern = pick_one(kUnionPayCardNumberFormat); break;
-    case CardTypes::Visa           : pattern = pick_one(kVisaCardNumberFormat); break;
+    case CardTypes::AmericanExpress: pattern = &pick_one(kAmericanExpressCardNumberPatterns); break;
+    case CardTypes::JCB            : pattern = &pick_one(kJCBCardNumberPatterns); break;
+    case CardTypes::MasterCard     : pattern = &pick_one(kMasterCardNumberPatterns); break;
+    case CardTypes::UnionPay       : pattern = &pick_one(kUnionPayCardNumberPatterns); break;
+    case CardTypes::Visa           : pattern = &pick_one(kVisaCardNumberPatterns); break;
     }
 
-    return replace_wildcard_to_digit(pattern);
+    return pattern->expand();
+}
+
+bool is_valid_card_number(const std::string_view card_number) {
+    return is_luhn_valid(card_number);
+}
+
+std::size_t validate_card_numbers(
+    const std::span<const char> card_numbers,
+    const std::span<bool>       results,
+    const char                  delimiter
+) {
+    return validate_luhn_records(card_numbers, results, delimiter);
 }
 
 std::string card_date(const std::string_view start, const std::string_view end) {
@@ -146,7 +154,7 @@ std::string Card::date() const {
 void Card::roll() {
     language_  = pick_language(languages_);
     card_type_ = pick_card_type(card_types_);
-    type_      = std::string(kCardTypes.at(language_).at(card_type_));
+    type_      = std::string(kCardTypes[language_][card_type_]);
     number_    = card_number(card_types_);
     date_      = get_card_date(start_, end_, location);
 }
@@ -9,13 +9,14 @@
 
 #include <array>
 #include <string_view>
-#include <unordered_map>
 
+#include "enum_table.h"
 #include "faker/types/enums.h"
+#include "wildcard_pattern.h"
 
 namespace faker::payment {
 
-const std::unordered_map<Languages, std::unordered_map<CardTypes, std::string_view>> kCardTypes = {
+constexpr EnumTable<Languages, EnumTable<CardTypes, std::string_view, 5>, 4> kCardTypes = {
     {Languages::English,
      {
          {CardTypes::AmericanExpress, "American Express"},
@@ -49,6 +50,7 @@ const std::unordered_map<Languages, std::unordered_map<CardTypes, std::string_vi
          {CardTypes::Visa, "Visa"},
      }},
 };
+static_assert(kCardTypes.is_complete());
 
 constexpr auto kAmericanExpressCardNumberFormat =
     std::to_array<std::string_view>({"34#############", "37#############"});
@@ -92,6 +94,17 @@ constexpr auto kUnionPayCardNumberFormat = std::to_array<std::string_view>(
 
 constexpr auto kVisaCardNumberFormat = std::to_array<std::string_view>({"4###############"});
 
+constexpr auto kAmericanExpressCardNumberPatterns =
+    compile_wildcard_patterns(kAmericanExpressCardNumberFormat, CheckDigitScheme::Luhn);
+constexpr auto kJCBCardNumberPatterns =
+    compile_wildcard_patterns(kJCBCardNumberFormat, CheckDigitScheme::Luhn);
+constexpr auto kMasterCardNumberPatterns =
+    compile_wildcard_patterns(kMasterCardNumberFormat, CheckDigitScheme::Luhn);
+constexpr auto kUnionPayCardNumberPatterns =
+    compile_wildcard_patterns(kUnionPayCardNumberFormat, CheckDigitScheme::Luhn);
+constexpr auto kVisaCardNumberPatterns =
+    compile_wildcard_patterns(kVisaCardNumberFormat, CheckDigitScheme::Luhn);
+
 }  // namespace faker::payment
 
 #endif  // FAKER_PAYMENT_DATA_H
@@ -7,9 +7,15 @@
 #include "faker/person.h"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <format>
 #include <random>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "faker/types/bilingual.h"
@@ -18,6 +24,7 @@
 #include "random_helper.h"
 #include "string_helper.h"
 #include "validation.h"
+#include "wildcard_pattern.h"
 
 namespace faker::person {
 
@@ -43,44 +50,175 @@ static Bilingual format_full_name(const Languages language, const Bilingual& fir
     return full_name;
 }
 
-Bilingual first_name(const Languages languages, const Genders genders) {
-    const auto selected_language = pick_language(languages);
-    const auto selected_gender   = pick_gender(genders);
+static BilingualView pick_first_name(const Languages language, const Genders gender) {
+    if (gender == Genders::M) {
+        switch (language) {
+        case Languages::English           : return pick_one(kEnglishMaleFirstNamePool);
+        case Languages::SimplifiedChinese : return pick_one(kSimplifiedChineseMaleFirstNamePool);
+        case Languages::TraditionalChinese: return pick_one(kTraditionalChineseMaleFirstNamePool);
+        case Languages::Japanese          : return pick_one(kJapaneseMaleFirstNamePool);
+        }
+    } else if (gender == Genders::F) {
+        switch (language) {
+        case Languages::English           : return pick_one(kEnglishFemaleFirstNamePool);
+        case Languages::SimplifiedChinese : return pick_one(kSimplifiedChineseFemaleFirstNamePool);
+        case Languages::TraditionalChinese: return pick_one(kTraditionalChineseFemaleFirstNamePool);
+        case Languages::Japanese          : return pick_one(kJapaneseFemaleFirstNamePool);
+        }
+    }
+    return {"", ""};
+}
 
-    BilingualView view{"", ""};
-    if (selected_gender == Genders::M) {
-        switch (selected_language) {
-        case Languages::English           : view = pick_one(kEnglishMaleFirstNames); break;
-        case Languages::SimplifiedChinese : view = pick_one(kSimplifiedChineseMaleFirstNames); break;
-        case Languages::TraditionalChinese: view = pick_one(kTraditionalChineseMaleFirstNames); break;
-        case Languages::Japanese          : view = pick_one(kJapaneseMaleFirstNames); break;
+static BilingualView pick_last_name(const Languages language) {
+    switch (language) {
+    case Languages::English           : return pick_one(kEnglishLastNamePool);
+    case Languages::SimplifiedChinese : return pick_one(kSimplifiedChineseLastNamePool);
+    case Languages::TraditionalChinese: return pick_one(kTraditionalChineseLastNamePool);
+    case Languages::Japanese          : return pick_one(kJapaneseLastNamePool);
+    }
+    return {"", ""};
+}
+
+// Macron vowels of romanized Japanese names, written as plain vowels in emails.
+constexpr auto kMacronVowels = std::to_array<std::pair<std::string_view, char>>({
+    {"ā", 'a'},
+    {"Ā", 'A'},
+    {"ē", 'e'},
+    {"Ē", 'E'},
+    {"ī", 'i'},
+    {"Ī", 'I'},
+    {"ō", 'o'},
+    {"Ō", 'O'},
+    {"ū", 'u'},
+    {"Ū", 'U'},
+});
+
+static char to_email_char(const char c, const bool lowercase) {
+    return lowercase && c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// Writes the ASCII letters and digits of a name, macron vowels as plain vowels. Spaces, hyphens and other
+// characters are dropped.
+static char* write_email_name(char* out, const std::string_view name, const bool lowercase) {
+    for (std::size_t i = 0; i < name.size();) {
+        const auto c = static_cast<unsigned char>(name[i]);
+        if (c < 0x80) {
+            if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) {
+                *out++ = to_email_char(static_cast<char>(c), lowercase);
+            }
+            ++i;
+            continue;
         }
-    } else if (selected_gender == Genders::F) {
-        switch (selected_language) {
-        case Languages::English           : view = pick_one(kEnglishFemaleFirstNames); break;
-        case Languages::SimplifiedChinese : view = pick_one(kSimplifiedChineseFemaleFirstNames); break;
-        case Languages::TraditionalChinese: view = pick_one(kTraditionalChineseFemaleFirstNames); break;
-        case Languages::Japanese          : view = pick_one(kJapaneseFemaleFirstNames); break;
+        const std::size_t length = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2;
+        for (const auto& [vowel, plain] : kMacronVowels) {
+            if (name.substr(i, length) == vowel) {
+                *out++ = to_email_char(plain, lowercase);
+                break;
+            }
         }
+        i += length;
     }
+    return out;
+}
 
-    auto bilingual = Bilingual(view.original, view.translation);
-    return bilingual;
+// Number of bytes write_email() needs at most.
+static std::size_t max_email_size(
+    const std::string_view affix,
+    const std::string_view first_part,
+    const std::string_view second_part,
+    const std::string_view domain
+) {
+    return affix.size() + first_part.size() + second_part.size() + 1 + domain.size();
 }
 
-Bilingual last_name(const Languages languages) {
-    const auto selected_name_language = pick_language(languages);
+// Writes an email in one pass: the affix with its "{}" replaced by the name parts and its '#' replaced by digits,
+// then '@' and the domain. The buffer must hold max_email_size() bytes.
+static std::size_t write_email(
+    const std::span<char>  out,
+    const std::string_view affix,
+    const std::string_view first_part,
+    const std::string_view second_part,
+    const std::string_view domain,
+    const bool             lowercase,
+    WildcardSymbols&       symbols
+) {
+    char* cursor = out.data();
+    for (std::size_t i = 0; i < affix.size(); ++i) {
+        if (affix.compare(i, 2, "{}") == 0) {
+            cursor = write_email_name(cursor, first_part, lowercase);
+            cursor = write_email_name(cursor, second_part, lowercase);
+            ++i;
+        } else if (affix[i] == '#') {
+            *cursor++ = symbols.digits[symbols.digits_source(symbols.engine)];
+        } else {
+            *cursor++ = to_email_char(affix[i], lowercase);
+        }
+    }
+    *cursor++ = '@';
+    for (const char c : domain) { *cursor++ = to_email_char(c, lowercase); }
+    return static_cast<std::size_t>(cursor - out.data());
+}
 
-    BilingualView view{"", ""};
-    switch (selected_name_language) {
-    case Languages::English           : view = pick_one(kEnglishLastNames); break;
-    case Languages::SimplifiedChinese : view = pick_one(kSimplifiedChineseLastNames); break;
-    case Languages::TraditionalChinese: view = pick_one(kTraditionalChineseLastNames); break;
-    case Languages::Japanese          : view = pick_one(kJapaneseLastNames); break;
+// Calls visit on each domain of a delimited list, trimmed and skipping empty ones.
+template <typename Visit>
+static void for_each_domain(const std::string_view domains, const char delimiter, Visit visit) {
+    constexpr std::string_view kSpaces = " \t\r\n";
+    std::size_t                begin   = 0;
+    while (begin <= domains.size()) {
+        std::size_t end = domains.find(delimiter, begin);
+        if (end == std::string_view::npos) { end = domains.size(); }
+        std::string_view domain = domains.substr(begin, end - begin);
+        domain.remove_prefix(std::min(domain.find_first_not_of(kSpaces), domain.size()));
+        domain.remove_suffix(domain.size() - (domain.find_last_not_of(kSpaces) + 1));
+        if (!domain.empty()) { visit(domain); }
+        begin = end + 1;
     }
+}
+
+static std::vector<std::string_view> split_domains(const std::string_view domains, const char delimiter) {
+    std::vector<std::string_view> list;
+    for_each_domain(domains, delimiter, [&](const std::string_view domain) { list.push_back(domain); });
+    if (list.empty()) {
+        throw_exception<std::invalid_argument>("Invalid argument: no domain in '" + std::string(domains) + "'.");
+    }
+    return list;
+}
+
+static std::vector<std::string> split_owned_domains(const std::string_view domains, const char delimiter) {
+    const std::vector<std::string_view> list = split_domains(domains, delimiter);
+    return {list.begin(), list.end()};
+}
+
+// Picks one domain of a delimited list without splitting it into strings.
+static std::string_view pick_domain(const std::string_view domains, const char delimiter) {
+    std::size_t count = 0;
+    for_each_domain(domains, delimiter, [&](std::string_view) { ++count; });
+    if (count == 0) {
+        throw_exception<std::invalid_argument>("Invalid argument: no domain in '" + std::string(domains) + "'.");
+    }
+    std::size_t      index = std::uniform_int_distribution<std::size_t>(0, count - 1)(get_random_engine());
+    std::string_view picked;
+    for_each_domain(domains, delimiter, [&](const std::string_view domain) {
+        if (index-- == 0) { picked = domain; }
+    });
+    return picked;
+}
+
+// The romanized name parts of an email, in the order of the full name.
+static std::pair<std::string_view, std::string_view>
+    email_name_parts(const Languages language, const BilingualView& first_name, const BilingualView& last_name) {
+    if (language == Languages::English) { return {first_name.translation, last_name.translation}; }
+    return {last_name.translation, first_name.translation};
+}
+
+Bilingual first_name(const Languages languages, const Genders genders) {
+    const auto selected_language = pick_language(languages);
+    const auto selected_gender   = pick_gender(genders);
+    return Bilingual(pick_first_name(selected_language, selected_gender));
+}
 
-    auto bilingual = Bilingual(view.original, view.translation);
-    return bilingual;
+Bilingual last_name(const Languages languages) {
+    return Bilingual(pick_last_name(pick_language(languages)));
 }
 
 Bilingual full_name(const Languages languages, const Genders genders) {
@@ -98,7 +236,7 @@ std::string gender(const Languages languages) {
     const auto        selected_language = pick_language(languages);
     constexpr Genders genders           = Genders::M | Genders::F;
     const auto        selected_gender   = pick_gender(genders);
-    return std::string(kGenders.at(selected_language).at(selected_gender));
+    return std::string(kGenders[selected_language][selected_gender]);
 }
 
 std::string title(const Languages languages, const Genders genders) {
@@ -145,7 +283,7 @@ std::string marital_status(const Languages languages) {
 std::string phone_number(const bool is_international, const bool include_delimiters, const Regions regions) {
     const auto selected_region = pick_region(regions);
 
-    std::string pattern;
+    std::string_view pattern;
     switch (selected_region) {
     case Regions::UnitedStates : pattern = pick_one(kUnitedStatesPhoneNumberFormat); break;
     case Regions::UnitedKingdom: pattern = pick_one(kUnitedKingdomPhoneNumberFormat); break;
@@ -153,49 +291,104 @@ std::string phone_number(const bool is_international, const bool include_delimit
     case Regions::Japan        : pattern = pick_one(kJapanPhoneNumberFormat); break;
     }
 
-    const auto code = kRegionCodes.at(selected_region);
+    const auto             code            = kRegionCodes[selected_region];
+    const std::string_view chars_to_remove = include_delimiters ? "" : " -()";
 
+    WildcardPattern phone_number_pattern;
     if (!is_international) {
         // Add a leading zero for the United Kingdom and Japan
-        if (selected_region == Regions::UnitedKingdom || selected_region == Regions::Japan) {
-            const auto first_digit =
-                std::find_if(pattern.begin(), pattern.end(), [](unsigned char c) { return std::isdigit(c); });
-            if (first_digit != pattern.end()) {
-                if (first_digit[0] != '0') { pattern.insert(first_digit, '0'); }
-            }
+        const auto first_digit =
+            std::find_if(pattern.begin(), pattern.end(), [](unsigned char c) { return std::isdigit(c); });
+        if ((selected_region == Regions::UnitedKingdom || selected_region == Regions::Japan) &&
+            first_digit != pattern.end() &&
+            *first_digit != '0') {
+            const auto first_digit_pos = static_cast<size_t>(first_digit - pattern.begin());
+            phone_number_pattern.append(pattern.substr(0, first_digit_pos), chars_to_remove)
+                .append_literal("0")
+                .append(pattern.substr(first_digit_pos), chars_to_remove);
+        } else {
+            phone_number_pattern.append(pattern, chars_to_remove);
         }
     } else {
-        pattern = std::format("+{0} {1}", code, pattern);
+        phone_number_pattern.append_literal("+")
+            .append_literal(code)
+            .append_literal(" ", chars_to_remove)
+            .append(pattern, chars_to_remove);
     }
 
-    std::string phone_number = replace_wildcard_to_digit(pattern);
-    if (!include_delimiters) { phone_number = remove_characters(phone_number, " -()"); }
-
-    return phone_number;
+    return phone_number_pattern.expand();
 }
 
-std::string email(const Languages languages, const std::string_view domains, const char delimiter) {
+std::string email(
+    const Languages        languages,
+    const std::string_view domains,
+    const char             delimiter,
+    const bool             lowercase
+) {
     CHECK_EMPTY(std::invalid_argument, domains);
 
     const auto selected_language = pick_language(languages);
+    const auto selected_gender   = pick_gender(Genders::M | Genders::F);
+    const auto selected_domain   = pick_domain(domains, delimiter);
 
-    auto selected_domain = pick_one<std::string>(split_and_trim(domains, delimiter));
-
-    constexpr Genders genders = Genders::M | Genders::F;
-
-    const Bilingual bilingual = full_name(selected_language, genders);
-
+    const auto [first_part, second_part] = email_name_parts(
+        selected_language,
+        pick_first_name(selected_language, selected_gender),
+        pick_last_name(selected_language)
+    );
     const auto selected_prefix_or_suffix = pick_one(kEmailPrefixesAndSuffixes);
 
-    std::string user_name = remove_characters(
-        replace_wildcard_to_digit(replace_placeholder(selected_prefix_or_suffix, bilingual.original())),
-        " -"
+    WildcardSymbols symbols;
+    std::string     email(max_email_size(selected_prefix_or_suffix, first_part, second_part, selected_domain), '\0');
+    email.resize(
+        write_email(email, selected_prefix_or_suffix, first_part, second_part, selected_domain, lowercase, symbols)
     );
-    std::string email = std::format("{0}@{1}", user_name, selected_domain);
-
     return email;
 }
 
+std::size_t emails(
+    const std::span<char>  buffer,
+    const std::size_t      count,
+    const Languages        languages,
+    const std::string_view domains,
+    const char             domains_delimiter,
+    const bool             lowercase,
+    const char             delimiter
+) {
+    CHECK_EMPTY(std::invalid_argument, domains);
+
+    const auto      domain_list = split_domains(domains, domains_delimiter);
+    WildcardSymbols symbols;
+    std::size_t     offset = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto selected_language = pick_language(languages);
+        const auto selected_gender   = pick_gender(Genders::M | Genders::F);
+
+        const auto [first_part, second_part] = email_name_parts(
+            selected_language,
+            pick_first_name(selected_language, selected_gender),
+            pick_last_name(selected_language)
+        );
+        const auto& selected_prefix_or_suffix = pick_one(kEmailPrefixesAndSuffixes);
+        const auto& selected_domain           = pick_one(std::span<const std::string_view>(domain_list));
+        if (buffer.size() - offset <
+            max_email_size(selected_prefix_or_suffix, first_part, second_part, selected_domain) + 1) {
+            break;
+        }
+        offset += write_email(
+            buffer.subspan(offset),
+            selected_prefix_or_suffix,
+            first_part,
+            second_part,
+            selected_domain,
+            lowercase,
+            symbols
+        );
+        buffer[offset++] = delimiter;
+    }
+    return offset;
+}
+
 std::string job_title(const Languages languages) {
     const auto selected_language = pick_language(languages);
 
@@ -221,24 +414,24 @@ Bilingual social_network_id(const Languages languages) {
 
     switch (selected_name_language) {
     case Languages::English:
-        social_network_id_view = pick_one(kEnglishSocialNetworkId);
+        social_network_id_view = pick_one(kEnglishSocialNetworkIdPool);
         prefix_or_suffix_view  = pick_one(kEnglishSocialNetworkIdPrefixesAndSuffixes);
         break;
     case Languages::SimplifiedChinese:
-        social_network_id_view = pick_one(kSimplifiedChineseSocialNetworkId);
+        social_network_id_view = pick_one(kSimplifiedChineseSocialNetworkIdPool);
         prefix_or_suffix_view  = pick_one(kSimplifiedChineseSocialNetworkIdPrefixesAndSuffixes);
         break;
     case Languages::TraditionalChinese:
-        social_network_id_view = pick_one(kTraditionalChineseSocialNetworkId);
+        social_network_id_view = pick_one(kTraditionalChineseSocialNetworkIdPool);
         prefix_or_suffix_view  = pick_one(kTraditionalChineseSocialNetworkIdPrefixesAndSuffixes);
         break;
     case Languages::Japanese:
-        social_network_id_view = pick_one(kJapaneseSocialNetworkId);
+        social_network_id_view = pick_one(kJapaneseSocialNetworkIdPool);
         prefix_or_suffix_view  = pick_one(kJapaneseSocialNetworkIdPrefixesAndSuffixes);
         break;
     }
 
-    const std::string number_suffix = replace_wildcard_to_digit(pick_one(kSocialNetworkIdNumberSuffixes));
+    const std::string number_suffix = pick_one(kSocialNetworkIdNumberSuffixPatterns).expand();
 
     std::string social_network_id_original = replace_placeholder(
         number_suffix,
@@ -252,20 +445,36 @@ Bilingual social_network_id(const Languages languages) {
     return {social_network_id_original, social_network_id_translation};
 }
 
+// Throws if a field of a person entity was not generated.
+static void check_generated(const PersonFields fields, const PersonFields field, const std::string_view name) {
+    if (!has_flag(fields, field)) {
+        throw_exception<std::logic_error>(
+            "Invalid access: the " + std::string(name) + " of the person was not generated."
+        );
+    }
+}
+
+// Adds the fields that the requested ones are made from.
+static PersonFields with_dependencies(PersonFields fields) {
+    if (has_flag(fields, PersonFields::Email)) { fields |= PersonFields::FullName; }
+    if (has_flag(fields, PersonFields::FullName)) { fields |= PersonFields::FirstName | PersonFields::LastName; }
+    if (has_flag(fields, PersonFields::Title)) { fields |= PersonFields::MaritalStatus; }
+    return fields;
+}
+
 Person::Person(
     const Genders          genders,
     const Languages        languages,
     const Regions          regions,
     const std::string_view email_domains,
-    const char             email_domains_delimiter
+    const char             email_domains_delimiter,
+    const PersonFields     fields
 ) :
     genders_(genders),
     languages_(languages),
     regions_(regions),
-    email_domains_(email_domains),
-    email_domains_delimiter_(email_domains_delimiter) {
-    CHECK_EMPTY(std::invalid_argument, email_domains);
-
+    email_domains_(split_owned_domains(email_domains, email_domains_delimiter)),
+    fields_(with_dependencies(fields)) {
     roll();
 }
 
@@ -276,32 +485,39 @@ void Person::reroll() {
 }
 
 Bilingual Person::full_name() const {
+    check_generated(fields_, PersonFields::FullName, "full name");
     return full_name_;
 }
 
 Bilingual Person::first_name() const {
+    check_generated(fields_, PersonFields::FirstName, "first name");
     return first_name_;
 }
 
 Bilingual Person::last_name() const {
+    check_generated(fields_, PersonFields::LastName, "last name");
     return last_name_;
 }
 
 std::string Person::gender() const {
+    check_generated(fields_, PersonFields::Gender, "gender");
     return gender_;
 }
 
 std::string Person::title() const {
+    check_generated(fields_, PersonFields::Title, "title");
     return title_;
 }
 
 std::string Person::marital_status() const {
+    check_generated(fields_, PersonFields::MaritalStatus, "marital status");
     return marital_status_;
 }
 
 std::string Person::phone_number(const bool is_international, const bool include_delimiters) const {
+    check_generated(fields_, PersonFields::PhoneNumber, "phone number");
     std::string      phone_number = phone_number_;
-    std::string_view region_code  = kRegionCodes.at(selected_region_);
+    std::string_view region_code  = kRegionCodes[selected_region_];
     if (is_international) { phone_number = std::format("+{0} {1}", region_code, phone_number_); }
 
     if (!include_delimiters) { phone_number = remove_characters(phone_number, " -()"); }
@@ -309,71 +525,97 @@ std::string Person::phone_number(const bool is_international, const bool include
 }
 
 std::string Person::email() const {
+    check_generated(fields_, PersonFields::Email, "email");
     return email_;
 }
 
 std::string Person::job_title() const {
+    check_generated(fields_, PersonFields::JobTitle, "job title");
     return job_title_;
 }
 
 Bilingual Person::social_network_id() const {
+    check_generated(fields_, PersonFields::SocialNetworkId, "social network ID");
     return social_network_id_;
 }
 
 void Person::roll() {
+    // The selections are always made, so that the generated fields agree with each other.
     selected_gender_   = pick_gender(genders_);
     selected_language_ = pick_language(languages_);
     selected_region_   = pick_region(regions_);
 
-    first_name_     = person::first_name(selected_language_, selected_gender_);
-    last_name_      = person::last_name(selected_language_);
-    full_name_      = format_full_name(selected_language_, first_name_, last_name_);
-    gender_         = std::string(kGenders.at(selected_language_).at(selected_gender_));
-    marital_status_ = person::marital_status(selected_language_);
-
-    title_ = person::title(selected_language_, selected_gender_);
-    if (selected_gender_ == Genders::F) {
-        switch (selected_language_) {
-        case Languages::English:
-            if (marital_status_ == "single") {
-                title_ = pick_one(kEnglishSingleFemaleTitle);
-            } else {
-                title_ = pick_one(kEnglishMarriedFemaleTitle);
-            }
-            break;
-        case Languages::SimplifiedChinese:
-            if (marital_status_ == "单身") {
-                title_ = pick_one(kSimplifiedChineseSingleFemaleTitle);
-            } else {
-                title_ = pick_one(kSimplifiedChineseMarriedFemaleTitle);
-            }
-            break;
-        case Languages::TraditionalChinese:
-            if (marital_status_ == "單身") {
-                title_ = pick_one(kTraditionalChineseSingleFemaleTitle);
-            } else {
-                title_ = pick_one(kTraditionalChineseMarriedFemaleTitle);
+    BilingualView first_name_view;
+    BilingualView last_name_view;
+    if (has_flag(fields_, PersonFields::FirstName)) {
+        first_name_view = pick_first_name(selected_language_, selected_gender_);
+        first_name_     = Bilingual(first_name_view);
+    }
+    if (has_flag(fields_, PersonFields::LastName)) {
+        last_name_view = pick_last_name(selected_language_);
+        last_name_     = Bilingual(last_name_view);
+    }
+    if (has_flag(fields_, PersonFields::FullName)) {
+        full_name_ = format_full_name(selected_language_, first_name_, last_name_);
+    }
+    if (has_flag(fields_, PersonFields::Gender)) {
+        gender_ = std::string(kGenders[selected_language_][selected_gender_]);
+    }
+    if (has_flag(fields_, PersonFields::MaritalStatus)) {
+        marital_status_ = person::marital_status(selected_language_);
+    }
+
+    if (has_flag(fields_, PersonFields::Title)) {
+        title_ = person::title(selected_language_, selected_gender_);
+        if (selected_gender_ == Genders::F) {
+            switch (selected_language_) {
+            case Languages::English:
+                if (marital_status_ == "single") {
+                    title_ = pick_one(kEnglishSingleFemaleTitle);
+                } else {
+                    title_ = pick_one(kEnglishMarriedFemaleTitle);
+                }
+                break;
+            case Languages::SimplifiedChinese:
+                if (marital_status_ == "单身") {
+                    title_ = pick_one(kSimplifiedChineseSingleFemaleTitle);
+                } else {
+                    title_ = pick_one(kSimplifiedChineseMarriedFemaleTitle);
+                }
+                break;
+            case Languages::TraditionalChinese:
+                if (marital_status_ == "單身") {
+                    title_ = pick_one(kTraditionalChineseSingleFemaleTitle);
+                } else {
+                    title_ = pick_one(kTraditionalChineseMarriedFemaleTitle);
+                }
+                break;
+            case Languages::Japanese: break;
             }
-            break;
-        case Languages::Japanese: break;
         }
     }
 
-    phone_number_ = person::phone_number(false, true, selected_region_);
+    if (has_flag(fields_, PersonFields::PhoneNumber)) {
+        phone_number_ = person::phone_number(false, true, selected_region_);
+    }
 
-    auto domains_vector  = split_and_trim(email_domains_, email_domains_delimiter_);
-    auto selected_domain = pick_one<std::string>(domains_vector);
+    if (has_flag(fields_, PersonFields::Email)) {
+        const auto& selected_domain = pick_one<std::string>(email_domains_);
 
-    const auto  full_name_eng             = full_name_.translation();
-    const auto  selected_prefix_or_suffix = pick_one(kEmailPrefixesAndSuffixes);
-    std::string user_name                 = remove_characters(
-        replace_wildcard_to_digit(replace_placeholder(selected_prefix_or_suffix, full_name_eng)),
-        " -"
-    );
-    email_ = std::format("{0}@{1}", user_name, selected_domain);
+        const auto [first_part, second_part] = email_name_parts(selected_language_, first_name_view, last_name_view);
+        const auto selected_prefix_or_suffix = pick_one(kEmailPrefixesAndSuffixes);
 
-    job_title_         = person::job_title(selected_language_);
-    social_network_id_ = person::social_network_id(selected_language_);
+        WildcardSymbols symbols;
+        email_.resize(max_email_size(selected_prefix_or_suffix, first_part, second_part, selected_domain));
+        email_.resize(
+            write_email(email_, selected_prefix_or_suffix, first_part, second_part, selected_domain, false, symbols)
+        );
+    }
+
+    if (has_flag(fields_, PersonFields::JobTitle)) { job_title_ = person::job_title(selected_language_); }
+    if (has_flag(fields_, PersonFields::SocialNetworkId)) {
+        social_network_id_ = person::social_network_id(selected_language_);
+    }
 }
 
 }  // namespace faker::person
@@ -9,10 +9,12 @@
 
 #include <array>
 #include <string_view>
-#include <unordered_map>
 
+#include "enum_table.h"
 #include "faker/types/bilingual.h"
 #include "faker/types/enums.h"
+#include "string_pool.h"
+#include "wildcard_pattern.h"
 
 namespace faker::person {
 
@@ -340,6 +342,7 @@ constexpr auto kEnglishMaleFirstNames = std::to_array<BilingualView>({
     {"Xavier", "Xavier"},
     {"Zachary", "Zachary"},
 });
+inline constexpr auto kEnglishMaleFirstNamePool = make_bilingual_pool<kEnglishMaleFirstNames>();
 
 constexpr auto kEnglishFemaleFirstNames = std::to_array<BilingualView>({
     {"April", "April"},
@@ -724,6 +727,7 @@ constexpr auto kEnglishFemaleFirstNames = std::to_array<BilingualView>({
     {"Yvonne", "Yvonne"},
     {"Zoe", "Zoe"},
 });
+inline constexpr auto kEnglishFemaleFirstNamePool = make_bilingual_pool<kEnglishFemaleFirstNames>();
 
 constexpr auto kEnglishLastNames = std::to_array<BilingualView>({
     {"Smith", "Smith"},
@@ -1727,6 +1731,7 @@ constexpr auto kEnglishLastNames = std::to_array<BilingualView>({
     {"Key", "Key"},
     {"Cooke", "Cooke"},
 });
+inline constexpr auto kEnglishLastNamePool = make_bilingual_pool<kEnglishLastNames>();
 
 constexpr auto kSimplifiedChineseMaleFirstNames = std::to_array<BilingualView>({
     {"安", "An"},         {"白", "Bai"},        {"川", "Chuan"},      {"东", "Dong"},       {"风", "Feng"},
@@ -1849,6 +1854,7 @@ constexpr auto kSimplifiedChineseMaleFirstNames = std::to_array<BilingualView>({
     {"博弘", "Bohong"},   {"晨迅", "Chenxun"},  {"远志", "Yuanzhi"},  {"弘弘", "Honghong"}, {"颜辉", "Yanhui"},
     {"新远", "Xinyuan"},
 });
+inline constexpr auto kSimplifiedChineseMaleFirstNamePool = make_bilingual_pool<kSimplifiedChineseMaleFirstNames>();
 
 constexpr auto kSimplifiedChineseFemaleFirstNames = std::to_array<BilingualView>({
     {"丹", "Dan"},        {"菲", "Fei"},        {"歌", "Ge"},         {"虹", "Hong"},       {"娟", "Juan"},
@@ -1920,6 +1926,7 @@ constexpr auto kSimplifiedChineseFemaleFirstNames = std::to_array<BilingualView>
     {"曼嫄", "Manyuan"},  {"诗缦", "Shiman"},   {"颖儿", "Yinger"},   {"依凌", "Yiling"},   {"译乔", "Yiqiao"},
     {"奕乔", "Yiqiao"},   {"小希", "Xiaoxi"},   {"晓影", "Xiaoying"},
 });
+inline constexpr auto kSimplifiedChineseFemaleFirstNamePool = make_bilingual_pool<kSimplifiedChineseFemaleFirstNames>();
 
 constexpr auto kSimplifiedChineseLastNames = std::to_array<BilingualView>({
     {"赵", "Zhao"},        {"钱", "Qian"},     {"孙", "Sun"},         {"李", "Li"},        {"周", "Zhou"},
@@ -2011,6 +2018,7 @@ constexpr auto kSimplifiedChineseLastNames = std::to_array<BilingualView>({
     {"轩辕", "Xuanyuan"},  {"令狐", "Linghu"}, {"钟离", "Zhongli"},   {"宇文", "Yuwen"},   {"长孙", "Zhangsun"},
     {"慕容", "Murong"},    {"司徒", "Situ"},   {"司空", "Sikong"},
 });
+inline constexpr auto kSimplifiedChineseLastNamePool = make_bilingual_pool<kSimplifiedChineseLastNames>();
 
 constexpr auto kTraditionalChineseMaleFirstNames = std::to_array<BilingualView>({
     {"梓軒", "Chihin"},   {"宇軒", "Yuhin"},     {"子謙", "Chihim"},   {"樂軒", "Lokhin"},   {"子朗", "Chilong"},
@@ -2034,6 +2042,7 @@ constexpr auto kTraditionalChineseMaleFirstNames = std::to_array<BilingualView>(
     {"柏然", "Pakyin"},   {"立言", "Lapyin"},    {"君豪", "Kwanho"},   {"家寶", "Gaapo"},    {"梓熙", "Chiyei"},
     {"諾言", "Lokyin"},   {"俊銘", "Chunming"},  {"皓天", "Hotin"},    {"英傑", "Yingkit"},  {"俊輝", "Chunfai"},
 });
+inline constexpr auto kTraditionalChineseMaleFirstNamePool = make_bilingual_pool<kTraditionalChineseMaleFirstNames>();
 
 constexpr auto kTraditionalChineseFemaleFirstNames = std::to_array<BilingualView>({
     {"凱晴", "Hoiching"}, {"芷晴", "Chiching"},  {"曉晴", "Hiuching"},  {"子晴", "Chiching"}, {"凱琳", "Hoilam"},
@@ -2057,6 +2066,8 @@ constexpr auto kTraditionalChineseFemaleFirstNames = std::to_array<BilingualView
     {"靜怡", "Chingyee"}, {"嘉晞", "Kahei"},     {"凱喬", "Hoikiu"},    {"可兒", "Hoyee"},    {"嘉琳", "Kalam"},
     {"曉楠", "Hiunam"},   {"可欣", "Hoyan"},     {"芷盈", "Chiying"},   {"明慧", "Mingwai"},  {"凱淇", "Hoikei"},
 });
+inline constexpr auto kTraditionalChineseFemaleFirstNamePool =
+    make_bilingual_pool<kTraditionalChineseFemaleFirstNames>();
 
 constexpr auto kTraditionalChineseLastNames = std::to_array<BilingualView>({
     {"亞", "Ah"},    {"查", "Cha"},    {"單", "Tan"},    {"丹", "Tan"},    {"甘", "Kam"},     {"霍", "Fok"},
@@ -2134,6 +2145,7 @@ constexpr auto kTraditionalChineseLastNames = std::to_array<BilingualView>({
     {"智", "Chi"},   {"支", "Chi"},    {"祝", "Chuk"},   {"竺", "Chuk"},   {"柘", "Che"},     {"佘", "Yu"},
     {"羽", "Yu"},    {"雨", "Yu"},     {"葉", "Yeh"},    {"錢", "Chin"},   {"吳", "Goh"},
 });
+inline constexpr auto kTraditionalChineseLastNamePool = make_bilingual_pool<kTraditionalChineseLastNames>();
 
 constexpr auto kJapaneseMaleFirstNames = std::to_array<BilingualView>({
     {"歩", "Ayumu"},       {"明", "Akira"},       {"旭", "Asahi"},      {"淳", "Atsushi"},    {"昭", "Akira"},
@@ -2209,6 +2221,7 @@ constexpr auto kJapaneseMaleFirstNames = std::to_array<BilingualView>({
     {"晃", "Akira"},       {"彰", "Akira"},       {"晶", "Akira"},      {"耀", "Yo"},         {"庸", "Yo"},
     {"与", "Yo"},          {"世", "Yo"},          {"燿", "Yo"},
 });
+inline constexpr auto kJapaneseMaleFirstNamePool = make_bilingual_pool<kJapaneseMaleFirstNames>();
 
 constexpr auto kJapaneseFemaleFirstNames = std::to_array<BilingualView>({
     {"愛", "Ai"},        {"藍", "Ai"},         {"亜衣", "Ai"},       {"葵", "Aoi"},         {"碧", "Aoi"},
@@ -2275,6 +2288,7 @@ constexpr auto kJapaneseFemaleFirstNames = std::to_array<BilingualView>({
     {"亜里", "Ari"},     {"亜理沙", "Arisa"},  {"亜璃", "Ari"},      {"亜弥", "Aya"},       {"亜由", "Ayu"},
     {"亜悠", "Ayu"},     {"亜優", "Ayu"},      {"亜夢", "Amu"},
 });
+inline constexpr auto kJapaneseFemaleFirstNamePool = make_bilingual_pool<kJapaneseFemaleFirstNames>();
 
 constexpr auto kJapaneseLastNames = std::to_array<BilingualView>({
     {"青木", "Aoki"},         {"秋山", "Akiyama"},    {"浅野", "Asano"},       {"新井", "Arai"},
@@ -2379,8 +2393,9 @@ constexpr auto kJapaneseLastNames = std::to_array<BilingualView>({
     {"神山", "Kamiyama"},     {"小池", "Koike"},      {"寺西", "Teraishi"},    {"常盘", "Tokiwa"},
     {"朝比奈", "Asahina"},    {"池本", "Ikemoto"},    {"大原", "Ohara"},       {"奥本", "Okumoto"},
 });
+inline constexpr auto kJapaneseLastNamePool = make_bilingual_pool<kJapaneseLastNames>();
 
-const std::unordered_map<Languages, std::unordered_map<Genders, std::string_view>> kGenders = {
+constexpr EnumTable<Languages, EnumTable<Genders, std::string_view, 2>, 4> kGenders = {
     {Languages::English,
      {
          {Genders::M, "Male"},
@@ -2402,6 +2417,7 @@ const std::unordered_map<Languages, std::unordered_map<Genders, std::string_view
          {Genders::F, "女性"},
      }},
 };
+static_assert(kGenders.is_complete());
 
 constexpr auto kEnglishMaleTitle          = std::to_array<std::string_view>({"Mr.", "Dr.", "Prof."});
 constexpr auto kEnglishFemaleTitle        = std::to_array<std::string_view>({"Mrs.", "Ms.", "Miss", "Dr.", "Prof."});
@@ -2429,12 +2445,13 @@ constexpr auto kTraditionalChineseMaritalStatus =
     std::to_array<std::string_view>({"單身", "已婚", "別居", "離婚", "喪偶"});
 constexpr auto kJapaneseMaritalStatus = std::to_array<std::string_view>({"独身", "既婚", "別居", "離婚", "死別"});
 
-const std::unordered_map<Regions, std::string_view> kRegionCodes = {
+constexpr EnumTable<Regions, std::string_view, 4> kRegionCodes = {
     {Regions::UnitedStates, "1"},
     {Regions::UnitedKingdom, "44"},
     {Regions::China, "86"},
     {Regions::Japan, "81"},
 };
+static_assert(kRegionCodes.is_complete());
 
 constexpr auto kUnitedStatesPhoneNumberFormat = std::to_array<std::string_view>({
     "201-###-####", "205-###-####", "206-###-####", "207-###-####", "209-###-####", "212-###-####", "215-###-####",
@@ -2783,6 +2800,7 @@ constexpr auto kEnglishSocialNetworkId = std::to_array<BilingualView>({
     {"Sable", "Sable"},
     {"Talus", "Talus"},
 });
+inline constexpr auto kEnglishSocialNetworkIdPool = make_bilingual_pool<kEnglishSocialNetworkId>();
 
 constexpr auto kSimplifiedChineseSocialNetworkId = std::to_array<BilingualView>({
     {"苔痕", "TaiHen"},
@@ -2998,6 +3016,7 @@ constexpr auto kSimplifiedChineseSocialNetworkId = std::to_array<BilingualView>(
     {"莓团团", "MeiTuanTuan"},
     {"夜航船", "YeHangChuan"},
 });
+inline constexpr auto kSimplifiedChineseSocialNetworkIdPool = make_bilingual_pool<kSimplifiedChineseSocialNetworkId>();
 
 constexpr auto kTraditionalChineseSocialNetworkId = std::to_array<BilingualView>({
     {"維港夜", "Waigongje"},
@@ -3237,6 +3256,8 @@ constexpr auto kTraditionalChineseSocialNetworkId = std::to_array<BilingualView>
     {"APM不眠", "APMbatmin"},
     {"荃灣天空城", "Cyunwaantinhungsing"},
 });
+inline constexpr auto kTraditionalChineseSocialNetworkIdPool =
+    make_bilingual_pool<kTraditionalChineseSocialNetworkId>();
 
 constexpr auto kJapaneseSocialNetworkId = std::to_array<BilingualView>({
     {"月見草", "Tsukimisou"},
@@ -3670,6 +3691,7 @@ constexpr auto kJapaneseSocialNetworkId = std::to_array<BilingualView>({
     {"カッパーペニー", "Copperpenny"},
     {"ステンレススカイ", "Stainlesssky"},
 });
+inline constexpr auto kJapaneseSocialNetworkIdPool = make_bilingual_pool<kJapaneseSocialNetworkId>();
 
 constexpr auto kEmailPrefixesAndSuffixes = std::to_array<std::string_view>({
     "{}",
@@ -3693,6 +3715,8 @@ constexpr auto kSocialNetworkIdNumberSuffixes = std::to_array<std::string_view>(
     "{}####",
 });
 
+constexpr auto kSocialNetworkIdNumberSuffixPatterns = compile_wildcard_patterns(kSocialNetworkIdNumberSuffixes);
+
 constexpr auto kEnglishSocialNetworkIdPrefixesAndSuffixes = std::to_array<BilingualView>({
     {"{}", "{}"},
     {"TheReal{}", "TheReal{}"},
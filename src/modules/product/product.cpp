@@ -6,6 +6,8 @@
 
 #include "faker/product.h"
 
+#include <cstddef>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -15,6 +17,7 @@
 #include "random_helper.h"
 #include "string_helper.h"
 #include "validation.h"
+#include "wildcard_pattern.h"
 
 namespace faker::product {
 
@@ -71,18 +74,35 @@ std::string size() {
     return std::string(pick_one(kProductSizes));
 }
 
+static const WildcardPattern& pick_barcode_pattern(const BarcodeTypes barcode_types) {
+    switch (pick_barcode_type(barcode_types)) {
+    case BarcodeTypes::EAN8: return pick_one(kBarcodeEAN8Patterns);
+    case BarcodeTypes::UPCA: return pick_one(kBarcodeUPCAPatterns);
+    case BarcodeTypes::UPCE: return pick_one(kBarcodeUPCEPatterns);
+    case BarcodeTypes::ISBN: return pick_one(kBarcodeISBNPatterns);
+    default                : return pick_one(kBarcodeEAN13Patterns);
+    }
+}
+
 std::string barcode(const BarcodeTypes barcode_types) {
-    const auto selected_barcode = pick_barcode_type(barcode_types);
-
-    std::string_view barcode_format;
-    switch (selected_barcode) {
-    case BarcodeTypes::EAN13: barcode_format = pick_one(kBarcodeEAN13Formats); break;
-    case BarcodeTypes::EAN8 : barcode_format = pick_one(kBarcodeEAN8Formats); break;
-    case BarcodeTypes::UPCA : barcode_format = pick_one(kBarcodeUPCAFormats); break;
-    case BarcodeTypes::UPCE : barcode_format = pick_one(kBarcodeUPCEFormats); break;
-    case BarcodeTypes::ISBN : barcode_format = pick_one(kBarcodeISBNFormats); break;
+    return pick_barcode_pattern(barcode_types).expand();
+}
+
+std::size_t barcodes(
+    const std::span<char> buffer,
+    const std::size_t     count,
+    const BarcodeTypes    barcode_types,
+    const char            delimiter
+) {
+    WildcardSymbols symbols;
+    std::size_t     offset = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const WildcardPattern& pattern = pick_barcode_pattern(barcode_types);
+        if (buffer.size() - offset < pattern.size() + 1) { break; }
+        offset += pattern.expand(buffer.subspan(offset), symbols);
+        buffer[offset++] = delimiter;
     }
-    return replace_wildcard_to_digit(barcode_format);
+    return offset;
 }
 
 }  // namespace faker::product
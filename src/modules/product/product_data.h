@@ -10,6 +10,8 @@
 #include <array>
 #include <string_view>
 
+#include "wildcard_pattern.h"
+
 namespace faker::product {
 
 constexpr auto kEnglishProductNamePrefixesAndSuffixes = std::to_array<std::string_view>({
@@ -320,13 +322,10 @@ constexpr auto kBarcodeUPCAFormats = std::to_array<std::string_view>({
     "5###########",
 });
 
+// Number system 0 or 1, six compressed digits and the check digit.
 constexpr auto kBarcodeUPCEFormats = std::to_array<std::string_view>({
-    "0#####",
-    "1#####",
-    "6#####",
-    "7#####",
-    "3#####",
-    "5#####",
+    "0#######",
+    "1#######",
 });
 
 constexpr auto kBarcodeISBNFormats = std::to_array<std::string_view>({
@@ -334,6 +333,12 @@ constexpr auto kBarcodeISBNFormats = std::to_array<std::string_view>({
     "979##########",
 });
 
+constexpr auto kBarcodeEAN13Patterns = compile_wildcard_patterns(kBarcodeEAN13Formats, CheckDigitScheme::GS1);
+constexpr auto kBarcodeEAN8Patterns  = compile_wildcard_patterns(kBarcodeEAN8Formats, CheckDigitScheme::GS1);
+constexpr auto kBarcodeUPCAPatterns  = compile_wildcard_patterns(kBarcodeUPCAFormats, CheckDigitScheme::GS1);
+constexpr auto kBarcodeUPCEPatterns  = compile_wildcard_patterns(kBarcodeUPCEFormats, CheckDigitScheme::UPCE);
+constexpr auto kBarcodeISBNPatterns  = compile_wildcard_patterns(kBarcodeISBNFormats, CheckDigitScheme::GS1);
+
 }  // namespace faker::product
 
 #endif  // FAKER_PRODUCT_DATA_H
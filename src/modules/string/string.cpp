@@ -7,12 +7,24 @@
 #include "faker/string.h"
 
 #include <algorithm>
-#include <iomanip>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
 #include <random>
-#include <sstream>
+#include <source_location>
+#include <stdexcept>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "markov_chain.h"
 #include "random_engine.h"
 #include "random_helper.h"
 #include "string_data.h"
@@ -27,50 +39,380 @@ std::string enum_item(const std::string_view enums, const char delimiter) {
     return pick_one<std::string>(domains_vector);
 }
 
+// A random text: `size` characters of the cyclic corpus starting at `offset`.
+struct TextSlice {
+    std::size_t offset;
+    std::size_t size;
+};
+
+// Positions past the end of the corpus wrap around: position p is kEnglishCorpus[p % kEnglishCorpus.size()].
+constexpr std::size_t kCorpusSize = kEnglishCorpus.size();
+
+static char corpus_at(const std::size_t position) {
+    return kEnglishCorpus[position % kCorpusSize];
+}
+
+// The last boundary at or before `position` in the cyclic corpus, or npos if there is none.
+template <std::size_t N>
+static std::size_t
+    boundary_at_or_before(const std::array<std::uint32_t, N>& boundaries, const std::size_t position) {
+    const std::size_t cycle = position - position % kCorpusSize;
+    const auto*       it    = std::ranges::upper_bound(boundaries, position % kCorpusSize);
+    if (it != boundaries.begin()) { return cycle + *(it - 1); }
+    return cycle == 0 ? std::string::npos : cycle - kCorpusSize + boundaries.back();
+}
+
+// The first boundary at or after `position` in the cyclic corpus.
+template <std::size_t N>
+static std::size_t boundary_at_or_after(const std::array<std::uint32_t, N>& boundaries, const std::size_t position) {
+    const std::size_t cycle = position - position % kCorpusSize;
+    const auto*       it    = std::ranges::lower_bound(boundaries, position % kCorpusSize);
+    if (it != boundaries.end()) { return cycle + *it; }
+    return cycle + kCorpusSize + boundaries.front();
+}
+
+// The boundary-th boundary of the cyclic corpus, counting on through the following cycles.
+template <std::size_t N>
+static std::size_t nth_boundary(const std::array<std::uint32_t, N>& boundaries, const std::size_t index) {
+    return index / N * kCorpusSize + boundaries[index % N];
+}
+
+// Move the end of a slice close to `end` and within [min_end, max_end]: to a word end if one is in range,
+// or else between two UTF-8 characters.
+static std::size_t align_text_end(const std::size_t end, const std::size_t min_end, const std::size_t max_end) {
+    std::size_t aligned = boundary_at_or_before(kEnglishWordEnds, end);
+    if (aligned == std::string::npos || aligned < min_end) {
+        aligned = boundary_at_or_after(kEnglishWordEnds, min_end);
+    }
+    if (aligned <= max_end) { return aligned; }
+
+    const auto is_continuation = [](const char c) { return (static_cast<unsigned char>(c) & 0xC0) == 0x80; };
+    aligned = end;
+    while (aligned > min_end && is_continuation(corpus_at(aligned))) { --aligned; }
+    while (aligned < max_end && is_continuation(corpus_at(aligned))) { ++aligned; }
+    return aligned;
+}
+
+// The length is uniform up to the paragraph size, doubled until it reaches the minimum length, and the text ends
+// with a whole word when one fits. With a `limit`, the slice does not wrap and ends before `limit`.
+static TextSlice pick_text_slice(
+    const unsigned int          number_of_chars_start,
+    const unsigned int          number_of_chars_end,
+    std::mt19937_64&            random_engine,
+    const std::size_t           limit    = std::string::npos,
+    const std::source_location& location = std::source_location::current()
+) {
+    CHECK_RANGE_EX(std::invalid_argument, number_of_chars_start, number_of_chars_end, location);
+
+    std::uniform_int_distribution<std::size_t> source_distribution(0, kEnglishTexts.size() - 1);
+    const std::size_t                          paragraph = source_distribution(random_engine);
+
+    std::size_t max_length = kEnglishTexts[paragraph].size();
+    while (max_length < number_of_chars_start) { max_length *= 2; }
+    max_length = std::min<std::size_t>({max_length, number_of_chars_end, limit});
+
+    std::uniform_int_distribution<std::size_t> length_distribution(number_of_chars_start, max_length);
+    const std::size_t                          length = length_distribution(random_engine);
+
+    std::size_t offset = kEnglishTextOffsets[paragraph];
+    if (limit != std::string::npos && offset + length > limit) {
+        // Start at the last paragraph that leaves room instead.
+        offset = *(std::ranges::upper_bound(kEnglishTextOffsets, limit - length) - 1);
+    }
+    const std::size_t max_end = std::min(offset + max_length, limit);
+
+    return {offset, align_text_end(offset + length, offset + number_of_chars_start, max_end) - offset};
+}
+
+// Copy a slice of the cyclic corpus to `sink(data, size)`, one contiguous chunk at a time.
+template <typename Sink>
+static void copy_corpus(std::size_t offset, std::size_t size, Sink sink) {
+    offset %= kCorpusSize;
+    while (size > 0) {
+        const std::size_t chunk_size = std::min(size, kCorpusSize - offset);
+        sink(kEnglishCorpus.data() + offset, chunk_size);
+        size -= chunk_size;
+        offset = 0;
+    }
+}
+
+static std::string copy_corpus_to_string(const std::size_t offset, const std::size_t size) {
+    std::string result(size, '\0');
+    char*       out    = result.data();
+    const auto  append = [&out](const char* data, const std::size_t chunk_size) {
+        std::memcpy(out, data, chunk_size);
+        out += chunk_size;
+    };
+    copy_corpus(offset, size, append);
+    return result;
+}
+
+static std::size_t random_paragraph_offset(std::mt19937_64& random_engine) {
+    std::uniform_int_distribution<std::size_t> source_distribution(0, kEnglishTextOffsets.size() - 1);
+    return kEnglishTextOffsets[source_distribution(random_engine)];
+}
+
+// `count` consecutive units of the cyclic corpus, each ending at a boundary, starting at a random one.
+template <std::size_t N>
+static std::string random_boundary_run(const std::array<std::uint32_t, N>& boundaries, const std::size_t count) {
+    if (count == 0) { return {}; }
+
+    std::uniform_int_distribution<std::size_t> start_distribution(0, N - 1);
+    const std::size_t                          first = start_distribution(get_random_engine());
+
+    // A unit starts after the spaces that follow the previous boundary.
+    std::size_t begin = first == 0 ? 0 : boundaries[first - 1];
+    while (corpus_at(begin) == ' ') { ++begin; }
+    const std::size_t end = nth_boundary(boundaries, first + count - 1);
+    return copy_corpus_to_string(begin, end - begin);
+}
+
 std::string text(const unsigned int number_of_chars_start, const unsigned int number_of_chars_end) {
-    CHECK_RANGE(std::invalid_argument, number_of_chars_start, number_of_chars_end);
+    const TextSlice slice = pick_text_slice(number_of_chars_start, number_of_chars_end, get_random_engine());
+    return copy_corpus_to_string(slice.offset, slice.size);
+}
+
+std::string_view text_view(const unsigned int number_of_chars_start, const unsigned int number_of_chars_end) {
+    // The trailing space of the corpus is left out, so that a view never ends with it.
+    constexpr std::size_t kMaxSize = kCorpusSize - 1;
+    if (number_of_chars_start > kMaxSize) {
+        throw_exception<std::invalid_argument>(
+            "Invalid range: 'number_of_chars_start' must not be greater than " + std::to_string(kMaxSize) +
+            ". (Current: " + std::to_string(number_of_chars_start) + ")"
+        );
+    }
 
-    std::mt19937_64&                      random_engine = get_random_engine();
-    std::uniform_int_distribution<size_t> source_distribution(0, kEnglishTexts.size() - 1);
-    auto                                  selected = std::string(kEnglishTexts[source_distribution(random_engine)]);
+    const TextSlice slice =
+        pick_text_slice(number_of_chars_start, number_of_chars_end, get_random_engine(), kMaxSize);
+    return {kEnglishCorpus.data() + slice.offset, slice.size};
+}
+
+std::string words(const std::size_t count) {
+    return random_boundary_run(kEnglishWordEnds, count);
+}
+
+std::string sentences(const std::size_t count) {
+    return random_boundary_run(kEnglishSentenceEnds, count);
+}
+
+std::size_t write_text(const std::span<char> buffer) {
+    char*      out    = buffer.data();
+    const auto append = [&out](const char* data, const std::size_t size) {
+        std::memcpy(out, data, size);
+        out += size;
+    };
+    copy_corpus(random_paragraph_offset(get_random_engine()), buffer.size(), append);
+    return buffer.size();
+}
+
+void write_text(std::ostream& out, const std::size_t number_of_chars) {
+    const auto append = [&out](const char* data, const std::size_t size) {
+        out.write(data, static_cast<std::streamsize>(size));
+    };
+    copy_corpus(random_paragraph_offset(get_random_engine()), number_of_chars, append);
+}
 
-    while (static_cast<int>(selected.size()) < number_of_chars_start) { selected += selected; }
+// Word-level Markov chains of the corpus, one per order, see markov_text().
+struct EnglishMarkovModel {
+    // Each distinct word followed by a space, then padding for the 16-byte copies of write_markov_text().
+    std::vector<char>          spellings;
+    std::vector<std::uint32_t> spelling_offsets;
+    std::vector<MarkovChain>   chains;
+};
 
-    const unsigned int max_length = std::min(static_cast<unsigned int>(selected.size()), number_of_chars_end);
-    std::uniform_int_distribution length_distribution(number_of_chars_start, max_length);
-    const unsigned int            target_length = length_distribution(random_engine);
+constexpr std::size_t kMaxMarkovOrder   = 3;
+constexpr std::size_t kSpellingCopySize = 16;
 
-    return selected.substr(0, target_length);
+static EnglishMarkovModel train_english_markov_model() {
+    EnglishMarkovModel                                   model;
+    std::unordered_map<std::string_view, std::uint32_t> word_ids;
+    std::vector<std::uint32_t>                           tokens;
+    tokens.reserve(kEnglishWordEnds.size());
+
+    std::size_t begin = 0;
+    for (const std::uint32_t end : kEnglishWordEnds) {
+        while (kEnglishCorpus[begin] == ' ') { ++begin; }
+        const std::string_view word(kEnglishCorpus.data() + begin, end - begin);
+        const auto [it, inserted] = word_ids.try_emplace(word, static_cast<std::uint32_t>(word_ids.size()));
+        if (inserted) {
+            model.spelling_offsets.push_back(static_cast<std::uint32_t>(model.spellings.size()));
+            model.spellings.insert(model.spellings.end(), word.begin(), word.end());
+            model.spellings.push_back(' ');
+        }
+        tokens.push_back(it->second);
+        begin = end;
+    }
+    model.spelling_offsets.push_back(static_cast<std::uint32_t>(model.spellings.size()));
+    model.spellings.resize(model.spellings.size() + kSpellingCopySize, ' ');
+
+    for (std::size_t order = 1; order <= kMaxMarkovOrder; ++order) { model.chains.emplace_back(tokens, order); }
+    return model;
+}
+
+static const EnglishMarkovModel& english_markov_model() {
+    static const EnglishMarkovModel model = train_english_markov_model();
+    return model;
 }
 
-std::string uuid(const bool include_hyphens) {
-    std::mt19937_64&                        engine = get_random_engine();
-    std::uniform_int_distribution<uint32_t> distribution(0, 0xFFFFFFFF);
+// Draws the words of a Markov text, each spelling followed by a space.
+class MarkovWords {
+public:
+    MarkovWords(const std::size_t order, const double randomness, std::mt19937_64& random_engine) :
+        model_(english_markov_model()),
+        chain_(nullptr),
+        random_engine_(random_engine) {
+        if (order == 0 || order > kMaxMarkovOrder) {
+            throw_exception<std::invalid_argument>(
+                "Invalid argument: 'order' must be in [1, " + std::to_string(kMaxMarkovOrder) +
+                "]. (Current: " + std::to_string(order) + ")"
+            );
+        }
+        if (!(randomness >= 0 && randomness <= 1)) {
+            throw_exception<std::invalid_argument>(
+                "Invalid argument: 'randomness' must be in [0, 1]. (Current: " + std::to_string(randomness) + ")"
+            );
+        }
+        chain_ = &model_.chains[order - 1];
+        // 2^64 does not fit, randomness 1 restarts on every word except with probability 2^-64.
+        jump_threshold_ =
+            randomness == 1 ? ~std::uint64_t{0} : static_cast<std::uint64_t>(std::ldexp(randomness, 64));
+        state_ = random_state();
+    }
+
+    // The spelling of the next word and its trailing space, followed by at least 16 readable bytes.
+    std::string_view next() {
+        if (jump_threshold_ != 0 && random_engine_() < jump_threshold_) { state_ = random_state(); }
+        const MarkovChain::Step step = chain_->next(state_, random_engine_());
+        state_                       = step.state;
+        const std::uint32_t begin    = model_.spelling_offsets[step.token];
+        return {model_.spellings.data() + begin, model_.spelling_offsets[step.token + 1] - begin};
+    }
+
+private:
+    const EnglishMarkovModel& model_;
+    const MarkovChain*        chain_;
+    std::mt19937_64&          random_engine_;
+    std::uint64_t             jump_threshold_ = 0;
+    std::uint32_t             state_          = 0;
 
-    const uint32_t data1 = distribution(engine);
-    const auto     data2 = static_cast<uint16_t>(distribution(engine));
-    auto           data3 = static_cast<uint16_t>(distribution(engine));
+    // The context at a random word of the corpus, so contexts are drawn with their corpus frequency.
+    std::uint32_t random_state() {
+        return chain_->state_at(multiply_high(random_engine_(), chain_->position_count()));
+    }
+};
 
-    // Set version to 4 ---- 0100xxxx
-    data3 = data3 & 0x0FFF | 0x4000;
+std::string markov_text(const std::size_t number_of_words, const unsigned int order, const double randomness) {
+    MarkovWords words(order, randomness, get_random_engine());
+    std::string out;
+    for (std::size_t i = 0; i < number_of_words; ++i) { out += words.next(); }
+    if (!out.empty()) { out.pop_back(); }
+    return out;
+}
 
-    auto data4 = static_cast<uint16_t>(distribution(engine));
+std::size_t write_markov_text(const std::span<char> buffer, const unsigned int order, const double randomness) {
+    MarkovWords words(order, randomness, get_random_engine());
+    char*       out = buffer.data();
+    char* const end = out + buffer.size();
+    while (true) {
+        const std::string_view word      = words.next();
+        const auto             remaining = static_cast<std::size_t>(end - out);
+        if (word.size() <= kSpellingCopySize && remaining >= kSpellingCopySize) {
+            // A fixed-size copy is a pair of moves, the bytes past the word are overwritten by the next one.
+            std::memcpy(out, word.data(), kSpellingCopySize);
+        } else if (word.size() <= remaining) {
+            std::memcpy(out, word.data(), word.size());
+        } else {
+            break;
+        }
+        out += word.size();
+    }
+    return static_cast<std::size_t>(out - buffer.data());
+}
 
-    // Set variant bits to 10xxxxxx
-    data4 = data4 & 0x3FFF | 0x8000;
+// Last UUIDv7 timestamp and counter of the thread, see next_uuid_v7_high().
+static thread_local std::uint64_t g_uuid_v7_milliseconds = 0;
+static thread_local std::uint64_t g_uuid_v7_counter      = 0;
 
-    const uint64_t data5 = static_cast<uint64_t>(distribution(engine)) << 32 | distribution(engine);
+static std::uint64_t unix_milliseconds() {
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now).count());
+}
 
-    std::ostringstream oss;
-    oss << std::hex << std::setfill('0');
+/// Set the version 4 and variant 10 bits.
+static std::pair<std::uint64_t, std::uint64_t> uuid_v4_words(std::mt19937_64& random_engine) {
+    const std::uint64_t high = (random_engine() & 0xFFFFFFFFFFFF0FFF) | 0x0000000000004000;
+    const std::uint64_t low  = (random_engine() & 0x3FFFFFFFFFFFFFFF) | 0x8000000000000000;
+    return {high, low};
+}
 
-    if (include_hyphens) {
-        oss << std::setw(8) << data1 << "-" << std::setw(4) << data2 << "-" << std::setw(4) << data3 << "-" << std::setw(4) << data4 << "-" << std::setw(12) << (data5 & 0xFFFFFFFFFFFF);
-    } else {
-        oss << std::setw(8) << data1 << std::setw(4) << data2 << std::setw(4) << data3 << std::setw(4) << data4 << std::setw(12) << (data5 & 0xFFFFFFFFFFFF);
+/// The high word of a UUIDv7 is the 48-bit Unix time in milliseconds, the version and a 12-bit counter in rand_a
+/// (RFC 9562, section 6.2, method 1). A new millisecond starts the counter at a random value below 0x800, leaving room
+/// for at least 2048 increments. On overflow, or if the clock goes back, the timestamp of the previous UUID is reused
+/// or advanced, so the UUIDs of a thread are strictly increasing.
+static std::uint64_t next_uuid_v7_high(const std::uint64_t milliseconds, std::mt19937_64& random_engine) {
+    if (milliseconds > g_uuid_v7_milliseconds) {
+        g_uuid_v7_milliseconds = milliseconds;
+        g_uuid_v7_counter      = random_engine() & 0x7FF;
+    } else if (++g_uuid_v7_counter > 0xFFF) {
+        ++g_uuid_v7_milliseconds;
+        g_uuid_v7_counter = random_engine() & 0x7FF;
     }
+    return ((g_uuid_v7_milliseconds & 0xFFFFFFFFFFFF) << 16) | 0x7000 | g_uuid_v7_counter;
+}
+
+static std::pair<std::uint64_t, std::uint64_t>
+    uuid_v7_words(const std::uint64_t milliseconds, std::mt19937_64& random_engine) {
+    const std::uint64_t high = next_uuid_v7_high(milliseconds, random_engine);
+    const std::uint64_t low  = (random_engine() & 0x3FFFFFFFFFFFFFFF) | 0x8000000000000000;
+    return {high, low};
+}
 
-    return oss.str();
+/// Write the two words as 8-4-4-4-12 hex groups.
+static char* write_uuid(char* out, const std::uint64_t high, const std::uint64_t low, const bool include_hyphens) {
+    out = write_hex_bytes(out, high >> 32, 4);
+    if (include_hyphens) { *out++ = '-'; }
+    out = write_hex_bytes(out, high >> 16, 2);
+    if (include_hyphens) { *out++ = '-'; }
+    out = write_hex_bytes(out, high, 2);
+    if (include_hyphens) { *out++ = '-'; }
+    out = write_hex_bytes(out, low >> 48, 2);
+    if (include_hyphens) { *out++ = '-'; }
+    return write_hex_bytes(out, low, 6);
+}
+
+std::string uuid(const bool include_hyphens, const UuidVersion version) {
+    std::mt19937_64& random_engine = get_random_engine();
+
+    const auto [high, low] = version == UuidVersion::V7 ? uuid_v7_words(unix_milliseconds(), random_engine)
+                                                        : uuid_v4_words(random_engine);
+
+    std::string result(include_hyphens ? 36 : 32, '\0');
+    write_uuid(result.data(), high, low, include_hyphens);
+    return result;
+}
+
+std::size_t uuid_batch(
+    const std::span<char> buffer,
+    const std::size_t     count,
+    const bool            include_hyphens,
+    const UuidVersion     version,
+    const char            delimiter
+) {
+    std::mt19937_64& random_engine = get_random_engine();
+
+    // The clock is read once, the UUIDv7 counter keeps the batch strictly increasing.
+    const std::uint64_t milliseconds = version == UuidVersion::V7 ? unix_milliseconds() : 0;
+    const std::size_t   record_size  = include_hyphens ? 37 : 33;
+    const std::size_t   fitting      = std::min(count, buffer.size() / record_size);
+
+    char* out = buffer.data();
+    for (std::size_t i = 0; i < fitting; ++i) {
+        const auto [high, low] = version == UuidVersion::V7 ? uuid_v7_words(milliseconds, random_engine)
+                                                            : uuid_v4_words(random_engine);
+        out    = write_uuid(out, high, low, include_hyphens);
+        *out++ = delimiter;
+    }
+    return fitting * record_size;
 }
 
 }  // namespace faker::string
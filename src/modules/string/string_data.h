@@ -8,6 +8,8 @@
 #define FAKER_STRING_DATA_H
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 
 namespace faker::string {
@@ -446,6 +448,76 @@ constexpr auto kEnglishTexts = std::to_array<std::string_view>(
      "of elegant software engineering principles."}
 );
 
+/// kEnglishTexts joined by spaces, with a trailing space so that it can be read cyclically.
+/// A text slice of up to the whole corpus is then a single contiguous view.
+constexpr std::size_t kEnglishCorpusSize = [] {
+    std::size_t size = 0;
+    for (const std::string_view text : kEnglishTexts) { size += text.size() + 1; }
+    return size;
+}();
+
+constexpr auto kEnglishCorpus = [] {
+    std::array<char, kEnglishCorpusSize> corpus{};
+    std::size_t                          position = 0;
+    for (const std::string_view text : kEnglishTexts) {
+        for (const char c : text) { corpus[position++] = c; }
+        corpus[position++] = ' ';
+    }
+    return corpus;
+}();
+
+/// Offset of each kEnglishTexts paragraph in kEnglishCorpus, in increasing order.
+constexpr auto kEnglishTextOffsets = [] {
+    std::array<std::uint32_t, kEnglishTexts.size()> offsets{};
+    std::uint32_t                                   position = 0;
+    for (std::size_t i = 0; i < kEnglishTexts.size(); ++i) {
+        offsets[i] = position;
+        position += static_cast<std::uint32_t>(kEnglishTexts[i].size() + 1);
+    }
+    return offsets;
+}();
+
+/// Whether a position of kEnglishCorpus is the space right after a word.
+constexpr bool is_english_word_end(const std::size_t position) {
+    return kEnglishCorpus[position] == ' ' && position > 0 && kEnglishCorpus[position - 1] != ' ';
+}
+
+/// Whether a position of kEnglishCorpus is the space right after a sentence, possibly closed by a quote or bracket.
+constexpr bool is_english_sentence_end(const std::size_t position) {
+    if (!is_english_word_end(position)) { return false; }
+    char last = kEnglishCorpus[position - 1];
+    if ((last == ')' || last == '\'' || last == '"') && position > 1) { last = kEnglishCorpus[position - 2]; }
+    return last == '.' || last == '!' || last == '?';
+}
+
+template <std::size_t N, typename Predicate>
+constexpr std::array<std::uint32_t, N> make_english_boundary_index(Predicate is_boundary) {
+    std::array<std::uint32_t, N> boundaries{};
+    std::size_t                  count = 0;
+    for (std::size_t i = 0; i < kEnglishCorpus.size(); ++i) {
+        if (is_boundary(i)) { boundaries[count++] = static_cast<std::uint32_t>(i); }
+    }
+    return boundaries;
+}
+
+template <typename Predicate>
+constexpr std::size_t count_english_boundaries(Predicate is_boundary) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < kEnglishCorpus.size(); ++i) {
+        if (is_boundary(i)) { ++count; }
+    }
+    return count;
+}
+
+/// Positions in kEnglishCorpus of the space after each word, in increasing order.
+/// A text ending at one of them ends with a whole word. The last one is the trailing space of the corpus.
+constexpr auto kEnglishWordEnds =
+    make_english_boundary_index<count_english_boundaries(is_english_word_end)>(is_english_word_end);
+
+/// Positions in kEnglishCorpus of the space after each sentence, in increasing order.
+constexpr auto kEnglishSentenceEnds =
+    make_english_boundary_index<count_english_boundaries(is_english_sentence_end)>(is_english_sentence_end);
+
 }  // namespace faker::string
 
 #endif  // FAKER_STRING_DATA_H
@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file check_digit.cpp
+
+#include "check_digit.h"
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FAKER_HAS_SSE2 1
+#endif
+
+namespace faker {
+
+#if defined(FAKER_HAS_SSE2)
+/// 0xFF for the 32 bytes before a record of `size` bytes ending at byte 32, loaded from `kPaddingMask + size`.
+alignas(16) static constexpr unsigned char kPaddingMask[64] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+/// Luhn check of the last `size` bytes of a 32-byte window, `size` in `[2, 32]`. The bytes before the record are
+/// replaced with '0', so the check digit is always the last byte and the doubled digits are always the even bytes.
+static bool is_luhn_valid_sse2(const char* window, const std::size_t size) {
+    const __m128i zero       = _mm_setzero_si128();
+    const __m128i ascii_zero = _mm_set1_epi8('0');
+    const __m128i four       = _mm_set1_epi8(4);
+    const __m128i nine       = _mm_set1_epi8(9);
+    const __m128i even_bytes = _mm_set1_epi16(0x00FF);
+    __m128i       not_digits = zero;
+    __m128i       sum        = zero;
+
+    for (std::size_t offset = 0; offset < 32; offset += 16) {
+        const __m128i padding = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kPaddingMask + size + offset));
+        const __m128i raw     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(window + offset));
+        const __m128i chars   = _mm_or_si128(_mm_and_si128(padding, ascii_zero), _mm_andnot_si128(padding, raw));
+        const __m128i digits  = _mm_sub_epi8(chars, ascii_zero);
+        const __m128i carries = _mm_and_si128(_mm_cmpgt_epi8(digits, four), nine);
+        const __m128i doubled = _mm_sub_epi8(_mm_add_epi8(digits, digits), carries);
+        const __m128i weights = _mm_or_si128(_mm_and_si128(even_bytes, doubled), _mm_andnot_si128(even_bytes, digits));
+
+        // Bytes above 9 as unsigned, including everything below '0', are not digits.
+        not_digits = _mm_or_si128(not_digits, _mm_xor_si128(_mm_min_epu8(digits, nine), digits));
+        sum        = _mm_add_epi64(sum, _mm_sad_epu8(weights, zero));
+    }
+
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(not_digits, zero)) != 0xFFFF) { return false; }
+    const auto total = static_cast<unsigned>(_mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8)));
+    return total % 10 == 0;
+}
+#endif
+
+std::size_t
+    validate_luhn_records(const std::span<const char> records, const std::span<bool> results, const char delimiter) {
+    std::size_t count  = 0;
+    std::size_t offset = 0;
+    while (offset < records.size() && count < results.size()) {
+        const char*       begin = records.data() + offset;
+        const auto*       end   = static_cast<const char*>(std::memchr(begin, delimiter, records.size() - offset));
+        const std::size_t size  = end == nullptr ? records.size() - offset : static_cast<std::size_t>(end - begin);
+
+#if defined(FAKER_HAS_SSE2)
+        if (size < 2 || size > 32) {
+            results[count++] = is_luhn_valid({begin, size});
+        } else if (offset + size >= 32) {
+            // Read the window in place, it ends with the record.
+            results[count++] = is_luhn_valid_sse2(begin + size - 32, size);
+        } else {
+            char window[32] = {};
+            std::memcpy(window + sizeof(window) - size, begin, size);
+            results[count++] = is_luhn_valid_sse2(window, size);
+        }
+#else
+        results[count++] = is_luhn_valid({begin, size});
+#endif
+        offset += size + 1;
+    }
+    return count;
+}
+
+}  // namespace faker
@@ -0,0 +1,127 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file check_digit.h
+
+#ifndef FAKER_CHECK_DIGIT_H
+#define FAKER_CHECK_DIGIT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace faker {
+
+/// @brief Check digit appended by a wildcard pattern.
+enum class CheckDigitScheme : std::uint8_t {
+    None,  ///< No check digit.
+    Luhn,  ///< Luhn mod 10, used by payment card numbers.
+    GS1,   ///< GS1 mod 10 with weights 3 and 1, used by EAN-8, EAN-13, UPC-A and ISBN-13.
+    UPCE,  ///< GS1 mod 10 of the UPC-A number a UPC-E number expands to.
+};
+
+/// @brief Luhn contribution of a doubled digit, i.e. the digit sum of `2 * d`.
+inline constexpr std::array<std::uint8_t, 10> kLuhnDoubledDigits = {0, 2, 4, 6, 8, 1, 3, 5, 7, 9};
+
+/// @brief Luhn contribution of a digit.
+/// @param digit The digit value, in `[0, 9]`.
+/// @param distance Distance of the digit from the check digit, the check digit itself is at distance 0.
+/// @return The value added to the Luhn sum.
+constexpr unsigned luhn_weight(const unsigned digit, const std::size_t distance) {
+    return (distance & 1) != 0 ? kLuhnDoubledDigits[digit] : digit;
+}
+
+/// @brief Compute the Luhn check digit of a payload.
+/// @param payload The digits before the check digit.
+/// @return The check digit character.
+constexpr char luhn_check_digit(const std::string_view payload) {
+    unsigned sum = 0;
+    for (std::size_t i = 0; i < payload.size(); ++i) {
+        sum += luhn_weight(static_cast<unsigned>(payload[i] - '0'), payload.size() - i);
+    }
+    return static_cast<char>('0' + (10 - sum % 10) % 10);
+}
+
+/// @brief Check whether a number passes the Luhn check.
+/// @param number The digits, check digit last.
+/// @return True if the number has at least two characters, only digits and a valid check digit.
+constexpr bool is_luhn_valid(const std::string_view number) {
+    if (number.size() < 2) { return false; }
+    unsigned sum = 0;
+    for (std::size_t i = 0; i < number.size(); ++i) {
+        const char c = number[i];
+        if (c < '0' || c > '9') { return false; }
+        sum += luhn_weight(static_cast<unsigned>(c - '0'), number.size() - 1 - i);
+    }
+    return sum % 10 == 0;
+}
+
+/// @brief GS1 contribution of a digit.
+/// @param digit The digit value, in `[0, 9]`.
+/// @param distance Distance of the digit from the check digit, the check digit itself is at distance 0.
+/// @return The value added to the GS1 sum.
+constexpr unsigned gs1_weight(const unsigned digit, const std::size_t distance) {
+    return (distance & 1) != 0 ? 3 * digit : digit;
+}
+
+/// @brief Contribution of a digit to the sum of a positional check digit scheme.
+/// @param scheme The check digit scheme, UPC-E has no positional weights and always gives 0.
+/// @param digit The digit value, in `[0, 9]`.
+/// @param distance Distance of the digit from the check digit, the check digit itself is at distance 0.
+/// @return The value added to the sum.
+constexpr unsigned check_digit_weight(const CheckDigitScheme scheme, const unsigned digit, const std::size_t distance) {
+    switch (scheme) {
+    case CheckDigitScheme::Luhn: return luhn_weight(digit, distance);
+    case CheckDigitScheme::GS1 : return gs1_weight(digit, distance);
+    default                    : return 0;
+    }
+}
+
+/// @brief Compute the GS1 check digit of a payload, as used by EAN-8, EAN-13, UPC-A and ISBN-13.
+/// @param payload The digits before the check digit.
+/// @return The check digit character.
+constexpr char gs1_check_digit(const std::string_view payload) {
+    unsigned sum = 0;
+    for (std::size_t i = 0; i < payload.size(); ++i) {
+        sum += gs1_weight(static_cast<unsigned>(payload[i] - '0'), payload.size() - i);
+    }
+    return static_cast<char>('0' + (10 - sum % 10) % 10);
+}
+
+/// @brief Compute the check digit of a UPC-E number.
+///
+/// The check digit is the GS1 check digit of the UPC-A number the UPC-E number expands to.
+/// @param payload The number system digit followed by the six UPC-E digits.
+/// @return The check digit character.
+constexpr char upce_check_digit(const std::string_view payload) {
+    // d[0] is the number system digit, d[1..6] the compressed digits.
+    const auto d = [&](const std::size_t i) { return payload[i]; };
+
+    std::array<char, 11> upca{};
+    switch (d(6)) {
+    case '0':
+    case '1':
+    case '2': upca = {d(0), d(1), d(2), d(6), '0', '0', '0', '0', d(3), d(4), d(5)}; break;
+    case '3': upca = {d(0), d(1), d(2), d(3), '0', '0', '0', '0', '0', d(4), d(5)}; break;
+    case '4': upca = {d(0), d(1), d(2), d(3), d(4), '0', '0', '0', '0', '0', d(5)}; break;
+    default : upca = {d(0), d(1), d(2), d(3), d(4), d(5), '0', '0', '0', '0', d(6)}; break;
+    }
+    return gs1_check_digit({upca.data(), upca.size()});
+}
+
+/// @brief Run the Luhn check over delimiter-terminated records.
+///
+/// Records of up to 32 characters are checked with SSE2 when the target has it, longer ones fall back to
+/// @code is_luhn_valid()@endcode. The last record does not need a trailing delimiter.
+/// @param records The records.
+/// @param results One result per record.
+/// @param delimiter The record terminator.
+/// @return Number of records checked, at most `results.size()`.
+std::size_t validate_luhn_records(std::span<const char> records, std::span<bool> results, char delimiter);
+
+}  // namespace faker
+
+#endif  // FAKER_CHECK_DIGIT_H
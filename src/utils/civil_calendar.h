@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file civil_calendar.h
+
+#ifndef FAKER_CIVIL_CALENDAR_H
+#define FAKER_CIVIL_CALENDAR_H
+
+#include <cstdint>
+
+namespace faker {
+
+/// @brief A date of the proleptic Gregorian calendar.
+struct CivilDate {
+    std::int64_t year;
+    unsigned     month;  ///< In `[1, 12]`.
+    unsigned     day;    ///< In `[1, 31]`.
+};
+
+/// @brief Days since 1970-01-01 of a civil date, after Howard Hinnant's `days_from_civil`.
+///
+/// The year is shifted to start on March 1st, so that the leap day is the last day of the year and the days before a
+/// month are a linear function of the month. No table and no timezone are involved.
+/// @param year The year.
+/// @param month The month, in `[1, 12]`.
+/// @param day The day of the month, in `[1, 31]`.
+/// @return Days since 1970-01-01, negative before it.
+constexpr std::int64_t days_from_civil(std::int64_t year, const unsigned month, const unsigned day) {
+    year -= month <= 2 ? 1 : 0;
+    const std::int64_t era         = (year >= 0 ? year : year - 399) / 400;
+    const auto         year_of_era = static_cast<unsigned>(year - era * 400);
+    const unsigned     day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned     day_of_era  = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + static_cast<std::int64_t>(day_of_era) - 719468;
+}
+
+/// @brief Civil date of a day count since 1970-01-01, after Howard Hinnant's `civil_from_days`.
+/// @param days Days since 1970-01-01, negative before it.
+/// @return The civil date.
+constexpr CivilDate civil_from_days(std::int64_t days) {
+    days += 719468;
+    const std::int64_t era         = (days >= 0 ? days : days - 146096) / 146097;
+    const auto         day_of_era  = static_cast<unsigned>(days - era * 146097);
+    const unsigned     year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    const unsigned     day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const unsigned     shifted     = (5 * day_of_year + 2) / 153;
+    const unsigned     day         = day_of_year - (153 * shifted + 2) / 5 + 1;
+    const unsigned     month       = shifted < 10 ? shifted + 3 : shifted - 9;
+    return {static_cast<std::int64_t>(year_of_era) + era * 400 + (month <= 2 ? 1 : 0), month, day};
+}
+
+/// @brief Weekday of a day count since 1970-01-01, which was a Thursday.
+/// @param days Days since 1970-01-01, negative before it.
+/// @return The weekday, 0 for Sunday through 6 for Saturday.
+constexpr unsigned weekday_from_days(const std::int64_t days) {
+    return static_cast<unsigned>(days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6);
+}
+
+static_assert(days_from_civil(1970, 1, 1) == 0);
+static_assert(days_from_civil(2000, 3, 1) == 11017);
+static_assert(civil_from_days(11016).month == 2 && civil_from_days(11016).day == 29);
+static_assert(civil_from_days(-1).year == 1969 && civil_from_days(-1).day == 31);
+static_assert(weekday_from_days(0) == 4 && weekday_from_days(-5) == 6 && weekday_from_days(-4) == 0);
+
+}  // namespace faker
+
+#endif  // FAKER_CIVIL_CALENDAR_H
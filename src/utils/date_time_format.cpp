@@ -0,0 +1,210 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file date_time_format.cpp
+
+#include "date_time_format.h"
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <string_view>
+
+#include "civil_calendar.h"
+
+namespace faker {
+
+// "00" to "99", two bytes per value.
+static constexpr std::array<char, 200> kDigitPairs = [] {
+    std::array<char, 200> pairs{};
+    for (std::size_t i = 0; i < 100; ++i) {
+        pairs[2 * i]     = static_cast<char>('0' + i / 10);
+        pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+    }
+    return pairs;
+}();
+
+// Bytes reserved for a conversion handed to strftime, and for a year that does not fit in 4 digits.
+constexpr std::size_t kGenericFieldSize = 64;
+constexpr std::size_t kLongYearSize     = 20;
+
+// strftime flags, as in "%-d".
+constexpr std::string_view kFlags = "_-0^#";
+
+static char* write_two_digits(char* out, const unsigned value) {
+    out[0] = kDigitPairs[2 * value];
+    out[1] = kDigitPairs[2 * value + 1];
+    return out + 2;
+}
+
+static char* write_year(char* out, const std::int64_t year) {
+    if (year >= 0 && year <= 9999) {
+        out = write_two_digits(out, static_cast<unsigned>(year / 100));
+        return write_two_digits(out, static_cast<unsigned>(year % 100));
+    }
+    return std::to_chars(out, out + kLongYearSize, year).ptr;
+}
+
+static char* write_fraction(char* out, std::uint32_t nanoseconds, const unsigned width) {
+    // Write all 9 digits from the right, then keep the first `width`.
+    char digits[9];
+    for (int i = 8; i > 0; i -= 2) {
+        write_two_digits(digits + i - 1, nanoseconds % 100);
+        nanoseconds /= 100;
+    }
+    digits[0] = static_cast<char>('0' + nanoseconds);
+    for (unsigned i = 0; i < width; ++i) { out[i] = digits[i]; }
+    return out + width;
+}
+
+DateTimeFormat::DateTimeFormat(const std::string_view format) {
+    for (std::size_t i = 0; i < format.size();) {
+        const std::size_t percent = format.find('%', i);
+        if (percent != i) {
+            push_literal(format.substr(i, percent - i));
+            if (percent == std::string_view::npos) { break; }
+        }
+
+        // A conversion: '%', optional flags, width and E/O modifier, then the conversion character.
+        std::size_t end = percent + 1;
+        while (end < format.size() && kFlags.find(format[end]) != std::string_view::npos) { ++end; }
+        const std::size_t width_begin = end;
+        while (end < format.size() && format[end] >= '0' && format[end] <= '9') { ++end; }
+        const std::size_t width_end = end;
+        if (end < format.size() && (format[end] == 'E' || format[end] == 'O')) { ++end; }
+        if (end == format.size()) {
+            // A trailing '%' is kept as it is.
+            push_literal(format.substr(percent));
+            break;
+        }
+        const char        conversion = format[end];
+        const std::size_t size       = end + 1 - percent;
+        i                            = end + 1;
+
+        if (conversion == 'f' && width_begin == percent + 1 && width_end == end) {
+            const std::size_t digits = width_end - width_begin;
+            const auto        width  = digits == 0 ? 6 : digits == 1 ? format[width_begin] - '0' : 0;
+            if (width >= 1 && width <= 9) {
+                push_field(Field::Fraction, static_cast<std::uint8_t>(width));
+                continue;
+            }
+        }
+        if (size == 2) {
+            switch (conversion) {
+            case 'Y': push_field(Field::Year); continue;
+            case 'y': push_field(Field::YearOfCentury); continue;
+            case 'm': push_field(Field::Month); continue;
+            case 'd': push_field(Field::Day); continue;
+            case 'H': push_field(Field::Hour); continue;
+            case 'M': push_field(Field::Minute); continue;
+            case 'S': push_field(Field::Second); continue;
+            case '%': push_literal("%"); continue;
+            case 'F':
+                push_field(Field::Year);
+                push_literal("-");
+                push_field(Field::Month);
+                push_literal("-");
+                push_field(Field::Day);
+                continue;
+            case 'T':
+            case 'R':
+                push_field(Field::Hour);
+                push_literal(":");
+                push_field(Field::Minute);
+                if (conversion == 'T') {
+                    push_literal(":");
+                    push_field(Field::Second);
+                }
+                continue;
+            default: break;
+            }
+        }
+
+        tokens_.push_back({Field::Generic, 0, static_cast<std::uint32_t>(text_.size()), 0});
+        text_.append(format.substr(percent, size));
+        text_.push_back('\0');
+        max_size_ += kGenericFieldSize;
+        needs_date_         = true;
+        has_generic_fields_ = true;
+    }
+}
+
+void DateTimeFormat::push_literal(const std::string_view literal) {
+    if (!tokens_.empty() && tokens_.back().field == Field::Literal) {
+        tokens_.back().size += static_cast<std::uint32_t>(literal.size());
+    } else {
+        tokens_.push_back(
+            {Field::Literal, 0, static_cast<std::uint32_t>(text_.size()), static_cast<std::uint32_t>(literal.size())}
+        );
+    }
+    text_.append(literal);
+    max_size_ += literal.size();
+}
+
+void DateTimeFormat::push_field(const Field field, const std::uint8_t width) {
+    tokens_.push_back({field, width, 0, 0});
+    switch (field) {
+    case Field::Year    : max_size_ += kLongYearSize; break;
+    case Field::Fraction: max_size_ += width; break;
+    default             : max_size_ += 2; break;
+    }
+    needs_date_ = needs_date_ || field == Field::Year || field == Field::YearOfCentury || field == Field::Month ||
+                  field == Field::Day;
+}
+
+std::size_t DateTimeFormat::write(char* out, const DateTimeValue& value) const {
+    const char*     begin           = out;
+    const CivilDate date            = needs_date_ ? civil_from_days(value.days) : CivilDate{1970, 1, 1};
+    const unsigned  hour            = value.seconds_of_day / 3600;
+    const auto      year_of_century = static_cast<unsigned>((date.year % 100 + 100) % 100);
+
+    std::tm tm{};
+    if (has_generic_fields_) {
+        tm.tm_year = static_cast<int>(date.year - 1900);
+        tm.tm_mon  = static_cast<int>(date.month - 1);
+        tm.tm_mday = static_cast<int>(date.day);
+        tm.tm_hour = static_cast<int>(hour);
+        tm.tm_min  = static_cast<int>(value.seconds_of_day / 60 % 60);
+        tm.tm_sec  = static_cast<int>(value.seconds_of_day % 60);
+        tm.tm_wday = static_cast<int>(weekday_from_days(value.days));
+        tm.tm_yday = static_cast<int>(value.days - days_from_civil(date.year, 1, 1));
+    }
+
+    for (const Token& token : tokens_) {
+        switch (token.field) {
+        case Field::Literal:
+            for (std::uint32_t i = 0; i < token.size; ++i) { out[i] = text_[token.offset + i]; }
+            out += token.size;
+            break;
+        case Field::Year         : out = write_year(out, date.year); break;
+        case Field::YearOfCentury: out = write_two_digits(out, year_of_century); break;
+        case Field::Month        : out = write_two_digits(out, date.month); break;
+        case Field::Day          : out = write_two_digits(out, date.day); break;
+        case Field::Hour         : out = write_two_digits(out, hour); break;
+        case Field::Minute       : out = write_two_digits(out, value.seconds_of_day / 60 % 60); break;
+        case Field::Second       : out = write_two_digits(out, value.seconds_of_day % 60); break;
+        case Field::Fraction     : out = write_fraction(out, value.nanoseconds, token.width); break;
+        case Field::Generic:
+            out += std::strftime(out, kGenericFieldSize, text_.data() + token.offset, &tm);
+            break;
+        }
+    }
+    return static_cast<std::size_t>(out - begin);
+}
+
+std::string DateTimeFormat::format(const DateTimeValue& value) const {
+    // Short formats go through the stack, so the string is allocated once and at its final size.
+    if (max_size_ <= kGenericFieldSize) {
+        std::array<char, kGenericFieldSize> buffer{};
+        return {buffer.data(), write(buffer.data(), value)};
+    }
+    std::string out(max_size_, '\0');
+    out.resize(write(out.data(), value));
+    return out;
+}
+
+}  // namespace faker
@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file date_time_format.h
+
+#ifndef FAKER_DATE_TIME_FORMAT_H
+#define FAKER_DATE_TIME_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace faker {
+
+/// @brief A UTC point in time, split the way formats read it.
+struct DateTimeValue {
+    std::int64_t  days           = 0;  ///< Days since 1970-01-01.
+    std::uint32_t seconds_of_day = 0;  ///< In `[0, 86399]`.
+    std::uint32_t nanoseconds    = 0;  ///< In `[0, 999999999]`.
+};
+
+/// @brief A strftime format compiled once into fields that are written straight into a buffer.
+///
+/// `%Y`, `%y`, `%m`, `%d`, `%H`, `%M`, `%S`, `%F`, `%T`, `%R` and `%%` are written from a two-digit table, and
+/// `%f` or `%Nf` writes the first 6 or N (1 to 9) digits of the fractional second, which strftime has no
+/// conversion for. Any other conversion, or one with flags, width or an E/O modifier, is handed to `std::strftime`
+/// on its own, so exotic formats still work and only pay for the conversions that need it.
+/// @code
+/// const DateTimeFormat rfc3339("%Y-%m-%dT%H:%M:%S.%3fZ");
+/// rfc3339.format({19782, 45296, 789000000});  // "2024-02-29T12:34:56.789Z"
+/// @endcode
+class DateTimeFormat {
+public:
+    /// @brief Compile a format.
+    /// @param format The strftime format.
+    explicit DateTimeFormat(std::string_view format);
+
+    /// @brief Upper bound of the bytes a value is formatted to.
+    [[nodiscard]] std::size_t max_size() const {
+        return max_size_;
+    }
+
+    /// @brief Whether some conversion is handed to `std::strftime`.
+    [[nodiscard]] bool has_generic_fields() const {
+        return has_generic_fields_;
+    }
+
+    /// @brief Format a value into a caller buffer.
+    /// @param out Output buffer, must hold at least @code max_size()@endcode bytes.
+    /// @param value The value.
+    /// @return Number of bytes written.
+    std::size_t write(char* out, const DateTimeValue& value) const;
+
+    /// @brief Format a value into a new string.
+    /// @param value The value.
+    /// @return The formatted value.
+    [[nodiscard]] std::string format(const DateTimeValue& value) const;
+
+private:
+    enum class Field : std::uint8_t {
+        Literal,
+        Year,
+        YearOfCentury,
+        Month,
+        Day,
+        Hour,
+        Minute,
+        Second,
+        Fraction,
+        Generic,
+    };
+
+    struct Token {
+        Field         field;
+        std::uint8_t  width;   // Fraction digits.
+        std::uint32_t offset;  // Literal text, or a null-terminated strftime conversion, in `text_`.
+        std::uint32_t size;
+    };
+
+    std::vector<Token> tokens_;
+    std::string        text_;
+    std::size_t        max_size_           = 0;
+    bool               needs_date_         = false;
+    bool               has_generic_fields_ = false;
+
+    void push_literal(std::string_view literal);
+    void push_field(Field field, std::uint8_t width = 0);
+};
+
+}  // namespace faker
+
+#endif  // FAKER_DATE_TIME_FORMAT_H
@@ -0,0 +1,160 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file distributions.cpp
+
+#include "distributions.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace faker {
+
+/// Layer edges and densities of a ziggurat with `N` layers of equal area.
+///
+/// Layer 0 is the base strip: a rectangle of width `r` plus the tail beyond `r`, drawn as if it were a rectangle of
+/// width `x[0] = area / f(r)`. Layer `i >= 1` spans `[0, x[i]]` horizontally and `[f(x[i]), f(x[i + 1])]`
+/// vertically; the part left of `x[i + 1]` lies entirely under the curve.
+template <std::size_t N>
+struct ZigguratTables {
+    std::array<double, N + 1> x{};
+    std::array<double, N + 1> f{};
+    std::array<double, N>     ratio{};  // x[i + 1] / x[i], a draw below it is accepted at once.
+};
+
+template <std::size_t N, typename Density, typename InverseDensity>
+static ZigguratTables<N>
+    make_ziggurat_tables(const double r, const double area, Density density, InverseDensity inverse_density) {
+    ZigguratTables<N> tables;
+    tables.x[0] = area / density(r);
+    tables.x[1] = r;
+    for (std::size_t i = 1; i < N; ++i) {
+        const double y  = density(tables.x[i]) + area / tables.x[i];
+        tables.x[i + 1] = y < 1 ? inverse_density(y) : 0;
+    }
+    tables.x[N] = 0;
+    for (std::size_t i = 0; i <= N; ++i) { tables.f[i] = density(tables.x[i]); }
+    tables.f[0] = density(r);
+    for (std::size_t i = 0; i < N; ++i) { tables.ratio[i] = tables.x[i + 1] / tables.x[i]; }
+    return tables;
+}
+
+// Constants from Marsaglia and Tsang, "The Ziggurat Method for Generating Random Variables", 2000.
+static const ZigguratTables<128> kNormalTables = make_ziggurat_tables<128>(
+    3.442619855899,
+    9.91256303526217e-3,
+    [](const double x) { return std::exp(-0.5 * x * x); },
+    [](const double y) { return std::sqrt(-2 * std::log(y)); }
+);
+
+static const ZigguratTables<256> kExponentialTables = make_ziggurat_tables<256>(
+    7.697117470131487,
+    3.949659822581572e-3,
+    [](const double x) { return std::exp(-x); },
+    [](const double y) { return -std::log(y); }
+);
+
+double standard_normal(std::mt19937_64& engine) {
+    const ZigguratTables<128>& tables = kNormalTables;
+    const double               r      = tables.x[1];
+    while (true) {
+        // Bits 0-6 pick the layer, bit 7 the sign, bits 11-63 the position.
+        const std::uint64_t word      = engine();
+        const std::size_t   layer     = word & 0x7F;
+        const std::uint64_t sign_mask = (word & 0x80) << 56;
+        const double        fraction  = static_cast<double>(word >> 11) * 0x1p-53;
+        // Flip the sign bit instead of branching on a coin flip.
+        const auto with_sign = [sign_mask](const double x) {
+            return std::bit_cast<double>(std::bit_cast<std::uint64_t>(x) ^ sign_mask);
+        };
+
+        if (fraction < tables.ratio[layer]) { return with_sign(fraction * tables.x[layer]); }
+
+        if (layer == 0) {
+            // Marsaglia's tail method.
+            double x = 0;
+            double y = 0;
+            do {
+                x = -std::log(uniform_open_closed(engine)) / r;
+                y = -std::log(uniform_open_closed(engine));
+            } while (y + y < x * x);
+            return with_sign(r + x);
+        }
+
+        const double x = fraction * tables.x[layer];
+        const double y = tables.f[layer] + uniform_open_closed(engine) * (tables.f[layer + 1] - tables.f[layer]);
+        if (y < std::exp(-0.5 * x * x)) { return with_sign(x); }
+    }
+}
+
+double standard_exponential(std::mt19937_64& engine) {
+    const ZigguratTables<256>& tables = kExponentialTables;
+    const double               r      = tables.x[1];
+    while (true) {
+        // Bits 0-7 pick the layer, bits 11-63 the position.
+        const std::uint64_t word     = engine();
+        const std::size_t   layer    = word & 0xFF;
+        const double        fraction = static_cast<double>(word >> 11) * 0x1p-53;
+
+        if (fraction < tables.ratio[layer]) { return fraction * tables.x[layer]; }
+
+        // The tail beyond r is r plus a fresh exponential draw.
+        if (layer == 0) { return r - std::log(uniform_open_closed(engine)); }
+
+        const double x = fraction * tables.x[layer];
+        const double y = tables.f[layer] + uniform_open_closed(engine) * (tables.f[layer + 1] - tables.f[layer]);
+        if (y < std::exp(-x)) { return x; }
+    }
+}
+
+// log1p(x) / x, continuous at 0.
+static double log1p_over_x(const double x) {
+    return std::abs(x) > 1e-8 ? std::log1p(x) / x : 1 - x / 2;
+}
+
+// expm1(x) / x, continuous at 0.
+static double expm1_over_x(const double x) {
+    return std::abs(x) > 1e-8 ? std::expm1(x) / x : 1 + x / 2;
+}
+
+ZipfSampler::ZipfSampler(const std::uint64_t element_count, const double exponent) :
+    element_count_(element_count),
+    exponent_(exponent),
+    h_integral_x1_(h_integral(1.5) - 1),
+    h_integral_n_(h_integral(static_cast<double>(element_count) + 0.5)),
+    squeeze_(2 - h_integral_inverse(h_integral(2.5) - h(2))) {}
+
+std::uint64_t ZipfSampler::operator()(std::mt19937_64& engine) const {
+    const double max_rank = static_cast<double>(element_count_);
+    while (true) {
+        const double fraction = static_cast<double>(engine() >> 11) * 0x1p-53;
+        const double u        = h_integral_n_ + fraction * (h_integral_x1_ - h_integral_n_);
+        const double x        = h_integral_inverse(u);
+        const double k        = std::clamp(std::floor(x + 0.5), 1.0, max_rank);
+        if (k - x <= squeeze_ || u >= h_integral(k + 0.5) - h(k)) { return static_cast<std::uint64_t>(k); }
+    }
+}
+
+// The hat density, x^-exponent.
+double ZipfSampler::h(const double x) const {
+    return std::exp(-exponent_ * std::log(x));
+}
+
+// Integral of the hat from 1 to x, shifted so that it is defined for exponent 1 too.
+double ZipfSampler::h_integral(const double x) const {
+    const double log_x = std::log(x);
+    return expm1_over_x((1 - exponent_) * log_x) * log_x;
+}
+
+double ZipfSampler::h_integral_inverse(const double x) const {
+    const double t = std::max(-1.0, x * (1 - exponent_));
+    return std::exp(log1p_over_x(t) * x);
+}
+
+}  // namespace faker
@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file distributions.h
+
+#ifndef FAKER_DISTRIBUTIONS_H
+#define FAKER_DISTRIBUTIONS_H
+
+#include <cstdint>
+#include <random>
+
+namespace faker {
+
+/// @brief A uniform double in `(0, 1]`, from the top 53 bits of one engine word.
+inline double uniform_open_closed(std::mt19937_64& engine) {
+    return static_cast<double>((engine() >> 11) + 1) * 0x1p-53;
+}
+
+/// @brief Draw from the standard normal distribution with the Marsaglia-Tsang ziggurat.
+///
+/// One engine word gives the layer, the sign and the position in the layer. About 98.8% of the draws are accepted
+/// by a single table compare; the wedges and the tail beyond 3.44 use more words and an exp or log.
+/// @param engine The random engine.
+/// @return A normally distributed value with mean 0 and standard deviation 1.
+double standard_normal(std::mt19937_64& engine);
+
+/// @brief Draw from the standard exponential distribution with the Marsaglia-Tsang ziggurat.
+///
+/// Same layout as @code standard_normal()@endcode, with 256 layers and no sign bit. About 98.9% of the draws are
+/// accepted by a single table compare.
+/// @param engine The random engine.
+/// @return An exponentially distributed value with rate 1.
+double standard_exponential(std::mt19937_64& engine);
+
+/// @brief Draws Zipf-distributed ranks with Hörmann and Derflinger's rejection-inversion.
+///
+/// Rank `k` in `[1, n]` has probability proportional to `k^-exponent`. Setup is a few logarithms and each draw
+/// inverts the integral of a hat function, so the cost does not depend on `n`. Fewer than 1 in 10 draws are rejected
+/// for any exponent.
+class ZipfSampler {
+public:
+    /// @brief Create a sampler.
+    /// @param element_count Number of ranks `n`, must be at least 1.
+    /// @param exponent The exponent, must be greater than 0.
+    ZipfSampler(std::uint64_t element_count, double exponent);
+
+    /// @brief Draw the next rank.
+    /// @param engine The random engine.
+    /// @return A rank in `[1, element_count]`.
+    std::uint64_t operator()(std::mt19937_64& engine) const;
+
+private:
+    std::uint64_t element_count_;
+    double        exponent_;
+    double        h_integral_x1_;
+    double        h_integral_n_;
+    double        squeeze_;
+
+    [[nodiscard]] double h(double x) const;
+    [[nodiscard]] double h_integral(double x) const;
+    [[nodiscard]] double h_integral_inverse(double x) const;
+};
+
+}  // namespace faker
+
+#endif  // FAKER_DISTRIBUTIONS_H
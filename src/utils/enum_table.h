@@ -0,0 +1,112 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file enum_table.h
+
+#ifndef FAKER_ENUM_TABLE_H
+#define FAKER_ENUM_TABLE_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "faker/internal/bitwise_operators.h"
+
+namespace faker {
+
+/// @brief Dense index of an enumerator.
+///
+/// Flag enums, whose enumerators are `1 << i`, map to `i`. Other enums map to their value, which must count up
+/// from 0.
+/// @param value The enumerator.
+/// @return The index.
+template <typename E>
+    requires std::is_enum_v<E>
+constexpr std::size_t enum_index(const E value) {
+    const auto raw = static_cast<std::make_unsigned_t<std::underlying_type_t<E>>>(value);
+    if constexpr (enable_bitwise_operators_v<E>) {
+        return static_cast<std::size_t>(std::countr_zero(raw));
+    } else {
+        return static_cast<std::size_t>(raw);
+    }
+}
+
+/// @brief A constant table from the enumerators of an enum to values, stored as a plain array.
+///
+/// The table is built at compile time from key-value pairs, so it has no static initialization and a lookup is one
+/// indexed load. A repeated key or a key whose index is not below `N` does not compile when the table is
+/// `constexpr`. Tables can nest, the inner ones are written as braced pair lists.
+/// @code
+/// constexpr EnumTable<Genders, std::string_view, 2> kNames = {
+///     {Genders::M, "male"},
+///     {Genders::F, "female"},
+/// };
+/// static_assert(kNames.is_complete());
+/// kNames[Genders::F];  // "female"
+/// @endcode
+/// @tparam E The enum.
+/// @tparam T The value type, default constructible.
+/// @tparam N Number of enumerators.
+template <typename E, typename T, std::size_t N>
+class EnumTable {
+public:
+    /// @brief A key-value pair.
+    struct Entry {
+        E key;
+        T value;
+    };
+
+    /// @brief An empty table.
+    constexpr EnumTable() = default;
+
+    /// @brief Build the table.
+    /// @param entries The key-value pairs, each key at most once.
+    constexpr EnumTable(const std::initializer_list<Entry> entries) {
+        for (const Entry& entry : entries) {
+            const std::size_t index = enum_index(entry.key);
+            if (index >= N || present_[index]) { throw std::logic_error("EnumTable: key out of range or repeated."); }
+            values_[index]  = entry.value;
+            present_[index] = true;
+        }
+    }
+
+    /// @brief Whether every enumerator has a value, in the nested tables too.
+    [[nodiscard]] constexpr bool is_complete() const {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (!present_[i]) { return false; }
+            if constexpr (requires { values_[i].is_complete(); }) {
+                if (!values_[i].is_complete()) { return false; }
+            }
+        }
+        return true;
+    }
+
+    /// @brief Whether a key has a value.
+    [[nodiscard]] constexpr bool contains(const E key) const {
+        const std::size_t index = enum_index(key);
+        return index < N && present_[index];
+    }
+
+    /// @brief The value of a key, which must be in the table.
+    constexpr const T& operator[](const E key) const {
+        return values_[enum_index(key)];
+    }
+
+    /// @brief The values, in the order of the enumerators.
+    [[nodiscard]] constexpr std::span<const T, N> values() const {
+        return values_;
+    }
+
+private:
+    std::array<T, N>    values_{};
+    std::array<bool, N> present_{};
+};
+
+}  // namespace faker
+
+#endif  // FAKER_ENUM_TABLE_H
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file markov_chain.cpp
+
+#include "markov_chain.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "validation.h"
+
+namespace faker {
+
+// Token ids are packed 21 bits each into a 64-bit context key.
+constexpr unsigned      kTokenBits    = 21;
+constexpr std::size_t   kMaxOrder     = 3;
+constexpr std::uint32_t kMaxThreshold = std::numeric_limits<std::uint32_t>::max();
+
+MarkovChain::MarkovChain(const std::span<const std::uint32_t> tokens, const std::size_t order) {
+    const std::size_t size = tokens.size();
+    if (order == 0 || order > kMaxOrder || order > size) {
+        throw_exception<std::invalid_argument>(
+            "Invalid argument: 'order' must be in [1, " + std::to_string(std::min(kMaxOrder, size)) +
+            "]. (Current: " + std::to_string(order) + ")"
+        );
+    }
+
+    // Number the distinct contexts in order of first appearance.
+    std::unordered_map<std::uint64_t, std::uint32_t> state_ids;
+    position_states_.resize(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        std::uint64_t key = 0;
+        for (std::size_t j = 0; j < order; ++j) {
+            const std::uint32_t token = tokens[(i + j) % size];
+            if (token >> kTokenBits != 0) {
+                throw_exception<std::invalid_argument>(
+                    "Invalid argument: token ids must be below 2^21. (Current: " + std::to_string(token) + ")"
+                );
+            }
+            key = key << kTokenBits | token;
+        }
+        position_states_[i] = state_ids.try_emplace(key, static_cast<std::uint32_t>(state_ids.size())).first->second;
+    }
+
+    // The context at position i emits the token at i + order and moves on to the context at i + 1, so a transition
+    // is identified by its two states.
+    std::vector<std::tuple<std::uint32_t, std::uint32_t, std::uint32_t>> transitions(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        transitions[i] = {position_states_[i], position_states_[(i + 1) % size], tokens[(i + order) % size]};
+    }
+    std::ranges::sort(transitions);
+
+    row_offsets_.assign(state_ids.size() + 1, 0);
+    std::vector<std::uint64_t> counts;
+    for (std::size_t i = 0; i < size;) {
+        std::size_t run_end = i + 1;
+        while (run_end < size && transitions[run_end] == transitions[i]) { ++run_end; }
+        const auto [state, next_state, token] = transitions[i];
+        edges_.push_back({token, next_state, kMaxThreshold, static_cast<std::uint32_t>(edges_.size())});
+        counts.push_back(run_end - i);
+        ++row_offsets_[state + 1];
+        i = run_end;
+    }
+    for (std::size_t s = 1; s < row_offsets_.size(); ++s) { row_offsets_[s] += row_offsets_[s - 1]; }
+
+    // Vose's alias method on integer weights: each slot is worth `total` after scaling the counts by the row size.
+    std::vector<std::uint32_t> small;
+    std::vector<std::uint32_t> large;
+    for (std::size_t s = 0; s + 1 < row_offsets_.size(); ++s) {
+        const std::uint32_t begin = row_offsets_[s];
+        const std::uint32_t end   = row_offsets_[s + 1];
+        std::uint64_t       total = 0;
+        for (std::uint32_t e = begin; e < end; ++e) { total += counts[e]; }
+
+        small.clear();
+        large.clear();
+        for (std::uint32_t e = begin; e < end; ++e) {
+            counts[e] *= end - begin;
+            (counts[e] < total ? small : large).push_back(e);
+        }
+        while (!small.empty() && !large.empty()) {
+            const std::uint32_t less = small.back();
+            const std::uint32_t more = large.back();
+            small.pop_back();
+            edges_[less].threshold = static_cast<std::uint32_t>((counts[less] << 32) / total);
+            edges_[less].alias     = more;
+            counts[more] -= total - counts[less];
+            if (counts[more] < total) {
+                large.pop_back();
+                small.push_back(more);
+            }
+        }
+        // Slots left in either list are worth exactly `total`, they keep their own edge.
+    }
+}
+
+}  // namespace faker
@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file markov_chain.h
+
+#ifndef FAKER_MARKOV_CHAIN_H
+#define FAKER_MARKOV_CHAIN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "faker/internal/symbol_source.h"
+
+namespace faker {
+
+/// @brief An order-k Markov chain over token ids, trained once and sampled in O(1) per token.
+///
+/// A state is a context of `order` consecutive tokens of the training sequence, which is read as cyclic so that
+/// every state has a successor. The transitions are stored in CSR form: the outgoing edges of state `s` are
+/// `edges_[row_offsets_[s], row_offsets_[s + 1])`, and each edge carries the emitted token, the state it leads to and
+/// its slot of the row's Walker alias table. A step is one engine word: its multiply-high by the row size picks the
+/// slot, and the low half of the product is the coin that keeps the slot or takes its alias.
+class MarkovChain {
+public:
+    /// @brief A sampled transition.
+    struct Step {
+        std::uint32_t token;  ///< The emitted token.
+        std::uint32_t state;  ///< The state after the token.
+    };
+
+    /// @brief Train a chain on a token sequence.
+    /// @param tokens The training sequence, read as cyclic. Token ids must be below 2^21.
+    /// @param order Context length, in `[1, 3]`, and at most the sequence length.
+    MarkovChain(std::span<const std::uint32_t> tokens, std::size_t order);
+
+    /// @brief Number of distinct contexts.
+    [[nodiscard]] std::size_t state_count() const {
+        return row_offsets_.size() - 1;
+    }
+
+    /// @brief Number of distinct transitions.
+    [[nodiscard]] std::size_t edge_count() const {
+        return edges_.size();
+    }
+
+    /// @brief Number of tokens in the training sequence.
+    [[nodiscard]] std::size_t position_count() const {
+        return position_states_.size();
+    }
+
+    /// @brief The state of the context starting at a position of the training sequence.
+    /// @param position The position, below @code position_count()@endcode.
+    [[nodiscard]] std::uint32_t state_at(const std::size_t position) const {
+        return position_states_[position];
+    }
+
+    /// @brief Sample the successor of a state, each edge with probability proportional to its training count.
+    /// @param state The current state.
+    /// @param random_word One uniformly distributed 64-bit word.
+    [[nodiscard]] Step next(const std::uint32_t state, const std::uint64_t random_word) const {
+        const std::uint32_t begin = row_offsets_[state];
+        const std::uint64_t size  = row_offsets_[state + 1] - begin;
+        const Edge*         edge  = &edges_[begin + multiply_high(random_word, size)];
+        // The low half of `random_word * size` is uniform whatever slot the high half picked.
+        const auto coin = static_cast<std::uint32_t>((random_word * size) >> 32);
+        if (coin >= edge->threshold) { edge = &edges_[edge->alias]; }
+        return {edge->token, edge->next_state};
+    }
+
+private:
+    struct Edge {
+        std::uint32_t token;
+        std::uint32_t next_state;
+        std::uint32_t threshold;  // The slot keeps its own edge when the coin is below the threshold.
+        std::uint32_t alias;      // Edge index taken otherwise.
+    };
+
+    std::vector<std::uint32_t> row_offsets_;
+    std::vector<Edge>          edges_;
+    std::vector<std::uint32_t> position_states_;
+};
+
+}  // namespace faker
+
+#endif  // FAKER_MARKOV_CHAIN_H
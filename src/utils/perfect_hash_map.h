@@ -0,0 +1,139 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file perfect_hash_map.h
+
+#ifndef FAKER_PERFECT_HASH_MAP_H
+#define FAKER_PERFECT_HASH_MAP_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace faker {
+
+/// @brief A constant map from strings to values, with a perfect hash found at compile time.
+///
+/// The map uses hash and displace: every key is hashed once, the hash picks a bucket, and the bucket's displacement
+/// is mixed into the hash to pick the key's slot. The displacements are searched when the map is built, largest
+/// bucket first, until every key has a slot of its own. A lookup is one hash, two loads and one string comparison,
+/// with no probing and no static initialization. A repeated or empty key does not compile when the map is
+/// `constexpr`.
+/// @code
+/// constexpr PerfectHashMap kPorts(std::to_array<std::pair<std::string_view, int>>({{"http", 80}, {"https", 443}}));
+/// *kPorts.find("https");  // 443
+/// kPorts.find("ftp");  // nullptr
+/// @endcode
+/// @tparam V The value type, default constructible.
+/// @tparam N Number of keys.
+template <typename V, std::size_t N>
+class PerfectHashMap {
+public:
+    /// @brief Build the map.
+    /// @param entries The key-value pairs, with distinct non-empty keys.
+    consteval explicit PerfectHashMap(const std::array<std::pair<std::string_view, V>, N>& entries) {
+        std::array<std::uint64_t, N>      hashes{};
+        std::array<std::size_t, kBuckets> bucket_sizes{};
+        for (std::size_t i = 0; i < N; ++i) {
+            if (entries[i].first.empty()) { throw std::logic_error("PerfectHashMap: empty key."); }
+            hashes[i] = hash(entries[i].first);
+            ++bucket_sizes[hashes[i] & (kBuckets - 1)];
+        }
+
+        // Place the largest buckets first, while most slots are free.
+        std::array<std::size_t, kBuckets> order{};
+        for (std::size_t b = 0; b < kBuckets; ++b) { order[b] = b; }
+        for (std::size_t i = 1; i < kBuckets; ++i) {
+            for (std::size_t j = i; j > 0 && bucket_sizes[order[j]] > bucket_sizes[order[j - 1]]; --j) {
+                std::swap(order[j], order[j - 1]);
+            }
+        }
+
+        std::array<bool, kSlots> used{};
+        for (const std::size_t bucket : order) {
+            if (bucket_sizes[bucket] == 0) { break; }
+            for (std::uint32_t displacement = 0;; ++displacement) {
+                if (displacement == kMaxDisplacement) { throw std::logic_error("PerfectHashMap: no perfect hash."); }
+                std::array<bool, kSlots> taken = used;
+                bool                     fits  = true;
+                for (std::size_t i = 0; i < N && fits; ++i) {
+                    if ((hashes[i] & (kBuckets - 1)) != bucket) { continue; }
+                    const std::size_t slot = slot_of(hashes[i], displacement);
+                    if (taken[slot]) {
+                        // Another bucket's key, or a key of this bucket, which only a repeated key always hits.
+                        if (keys_[slot] == entries[i].first) {
+                            throw std::logic_error("PerfectHashMap: repeated key.");
+                        }
+                        fits = false;
+                    } else {
+                        taken[slot] = true;
+                        keys_[slot] = entries[i].first;
+                    }
+                }
+                if (!fits) {
+                    for (std::size_t slot = 0; slot < kSlots; ++slot) {
+                        if (!used[slot]) { keys_[slot] = {}; }
+                    }
+                    continue;
+                }
+                used                   = taken;
+                displacements_[bucket] = displacement;
+                break;
+            }
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            values_[slot_of(hashes[i], displacements_[hashes[i] & (kBuckets - 1)])] = entries[i].second;
+        }
+    }
+
+    /// @brief Find the value of a key.
+    /// @param key The key.
+    /// @return A pointer to the value, or `nullptr` if the key is not in the map.
+    [[nodiscard]] constexpr const V* find(const std::string_view key) const {
+        if (key.empty()) { return nullptr; }
+        const std::uint64_t h    = hash(key);
+        const std::size_t   slot = slot_of(h, displacements_[h & (kBuckets - 1)]);
+        return keys_[slot] == key ? &values_[slot] : nullptr;
+    }
+
+    /// @brief Number of keys.
+    [[nodiscard]] static constexpr std::size_t size() {
+        return N;
+    }
+
+private:
+    // About one bucket per 4 keys, and twice as many slots as keys.
+    static constexpr std::size_t   kBuckets         = std::bit_ceil(N / 4 + 1);
+    static constexpr std::size_t   kSlots           = std::bit_ceil(N * 2);
+    static constexpr std::uint32_t kMaxDisplacement = 1 << 16;
+
+    std::array<std::string_view, kSlots> keys_{};
+    std::array<V, kSlots>                values_{};
+    std::array<std::uint32_t, kBuckets>  displacements_{};
+
+    // FNV-1a, then a SplitMix64 finalizer so that the low bits pick the bucket well.
+    static constexpr std::uint64_t hash(const std::string_view key) {
+        std::uint64_t h = 0xCBF29CE484222325;
+        for (const char c : key) { h = (h ^ static_cast<unsigned char>(c)) * 0x100000001B3; }
+        return mix(h);
+    }
+
+    static constexpr std::uint64_t mix(std::uint64_t h) {
+        h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9;
+        h = (h ^ (h >> 27)) * 0x94D049BB133111EB;
+        return h ^ (h >> 31);
+    }
+
+    static constexpr std::size_t slot_of(const std::uint64_t h, const std::uint32_t displacement) {
+        return (mix(h + displacement * 0x9E3779B97F4A7C15) >> 32) & (kSlots - 1);
+    }
+};
+
+}  // namespace faker
+
+#endif  // FAKER_PERFECT_HASH_MAP_H
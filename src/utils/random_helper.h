@@ -8,12 +8,15 @@
 #define FAKER_RANDOM_HELPER_H
 
 #include <array>
+#include <cstddef>
 #include <random>
 #include <span>
 #include <vector>
 
+#include "faker/types/bilingual.h"
 #include "faker/types/enums.h"
 #include "random_engine.h"
+#include "string_pool.h"
 
 namespace faker {
 
@@ -22,6 +25,7 @@ namespace faker {
 /// @return A random element.
 template <typename T>
 const T& pick_one(std::span<const T> data) {
+    if (data.size() == 1) { return data.front(); }
     return data[std::uniform_int_distribution<std::size_t>(0, data.size() - 1)(get_random_engine())];
 }
 
@@ -33,6 +37,14 @@ const T& pick_one(const std::array<T, N>& data_array) {
     return pick_one(std::span<const T>(data_array));
 }
 
+/// @brief Get a random entry from a string pool.
+/// @param pool The pool to get a random entry from.
+/// @return A random entry.
+template <std::size_t N, std::size_t OriginalBytes, std::size_t TranslationBytes, bool SharedTranslations>
+BilingualView pick_one(const BilingualPool<N, OriginalBytes, TranslationBytes, SharedTranslations>& pool) {
+    return pool[std::uniform_int_distribution<std::size_t>(0, N - 1)(get_random_engine())];
+}
+
 /// @brief Get a random language from the given languages
 /// @param languages Languages
 /// @return A random language
@@ -7,12 +7,41 @@
 #ifndef FAKER_STRING_HELPER_H
 #define FAKER_STRING_HELPER_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <string_view>
 #include <vector>
 
 namespace faker {
 
+/// @brief Lowercase hex digit pairs of every byte value: "000102...feff".
+inline constexpr std::array<char, 512> kHexPairs = [] {
+    constexpr std::string_view kHexDigits = "0123456789abcdef";
+
+    std::array<char, 512> pairs{};
+    for (std::size_t i = 0; i < 256; ++i) {
+        pairs[2 * i]     = kHexDigits[i >> 4];
+        pairs[2 * i + 1] = kHexDigits[i & 0xF];
+    }
+    return pairs;
+}();
+
+/// @brief Write the low bytes of a value as lowercase hex, most significant byte first.
+/// @param out Output buffer, must hold at least `2 * bytes` characters.
+/// @param value The value to encode.
+/// @param bytes Number of low bytes of `value` to encode, at most 8.
+/// @return Pointer past the last written character.
+inline char* write_hex_bytes(char* out, const std::uint64_t value, const std::size_t bytes) {
+    for (std::size_t i = bytes; i > 0; --i) {
+        std::memcpy(out, &kHexPairs[2 * ((value >> (8 * (i - 1))) & 0xFF)], 2);
+        out += 2;
+    }
+    return out;
+}
+
 /// @brief Capitalize a word.
 /// @param word The word to capitalize.
 /// @return The capitalized word.
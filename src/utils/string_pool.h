@@ -0,0 +1,157 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file string_pool.h
+
+#ifndef FAKER_STRING_POOL_H
+#define FAKER_STRING_POOL_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+#include "faker/types/bilingual.h"
+
+namespace faker {
+
+/// @brief Longest string a pool can hold, the length is packed in 8 bits.
+inline constexpr std::size_t kMaxPooledStringSize = 0xFF;
+
+/// @brief Largest character blob a pool can have, the offset is packed in 24 bits.
+inline constexpr std::size_t kMaxStringPoolSize = std::size_t{1} << 24;
+
+/// @brief Pack the offset and length of a pooled string into 32 bits.
+/// @param offset Offset of the string in its blob.
+/// @param length Length of the string.
+/// @return The offset in the high 24 bits and the length in the low 8 bits.
+constexpr std::uint32_t pack_pooled_string(const std::size_t offset, const std::size_t length) {
+    return static_cast<std::uint32_t>(offset << 8 | length);
+}
+
+/// @brief Read a pooled string.
+/// @param chars The character blob.
+/// @param packed The packed offset and length.
+/// @return A view of the string in the blob.
+constexpr std::string_view pooled_string(const char* chars, const std::uint32_t packed) {
+    return {chars + (packed >> 8), packed & 0xFF};
+}
+
+/// @brief A constant table of bilingual strings, stored as character blobs and packed references.
+///
+/// A table of `BilingualView`s takes 32 bytes per entry, and its entries point at string literals spread over the
+/// read-only data, so random picks keep missing the cache on both the entry and the literal. A pool keeps the
+/// originals of the table in one contiguous blob and the translations in another, and references each string with a
+/// 32-bit offset and length, so the same table takes a fraction of the cache lines. The references of the originals
+/// and of the translations are separate arrays too, so a pick that only reads the originals never loads translation
+/// bytes. When every translation equals its original, as in the English tables, only the blob and references of the
+/// originals are stored.
+/// @code
+/// constexpr auto kNames = std::to_array<BilingualView>({{"张伟", "Zhang Wei"}, {"王芳", "Wang Fang"}});
+/// constexpr auto kNamePool = make_bilingual_pool<kNames>();
+/// kNamePool.translation(1);  // "Wang Fang"
+/// @endcode
+/// @tparam N Number of entries.
+/// @tparam OriginalBytes Size of the blob of originals.
+/// @tparam TranslationBytes Size of the blob of translations, 0 if it is shared with the originals.
+/// @tparam SharedTranslations Whether every translation equals its original.
+template <std::size_t N, std::size_t OriginalBytes, std::size_t TranslationBytes, bool SharedTranslations>
+class BilingualPool {
+public:
+    /// @brief Build the pool.
+    /// @param table The entries, each string at most kMaxPooledStringSize bytes long.
+    consteval explicit BilingualPool(const std::array<BilingualView, N>& table) {
+        std::size_t original_size    = 0;
+        std::size_t translation_size = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            refs_[i] = append(0, original_size, table[i].original);
+            if constexpr (!SharedTranslations) {
+                refs_[N + i] = append(kTranslationChars, translation_size, table[i].translation);
+            }
+        }
+    }
+
+    /// @brief Number of entries.
+    [[nodiscard]] static constexpr std::size_t size() {
+        return N;
+    }
+
+    /// @brief The original of an entry.
+    [[nodiscard]] constexpr std::string_view original(const std::size_t index) const {
+        return pooled_string(original_chars(), refs_[index]);
+    }
+
+    /// @brief The translation of an entry.
+    [[nodiscard]] constexpr std::string_view translation(const std::size_t index) const {
+        return pooled_string(translation_chars(), refs_[kTranslationRefs + index]);
+    }
+
+    /// @brief An entry.
+    constexpr BilingualView operator[](const std::size_t index) const {
+        return {original(index), translation(index)};
+    }
+
+    /// @brief The packed references of the originals.
+    [[nodiscard]] constexpr std::span<const std::uint32_t, N> original_refs() const {
+        return std::span<const std::uint32_t, N>(refs_.data(), N);
+    }
+
+    /// @brief The packed references of the translations, the ones of the originals if they are shared.
+    [[nodiscard]] constexpr std::span<const std::uint32_t, N> translation_refs() const {
+        return std::span<const std::uint32_t, N>(refs_.data() + kTranslationRefs, N);
+    }
+
+    /// @brief The blob of originals.
+    [[nodiscard]] constexpr const char* original_chars() const {
+        return chars_.data();
+    }
+
+    /// @brief The blob of translations, the one of the originals if they are shared.
+    [[nodiscard]] constexpr const char* translation_chars() const {
+        return chars_.data() + kTranslationChars;
+    }
+
+private:
+    // The references and the blob of translations follow the ones of the originals, unless they are shared.
+    static constexpr std::size_t kTranslationRefs  = SharedTranslations ? 0 : N;
+    static constexpr std::size_t kTranslationChars = SharedTranslations ? 0 : OriginalBytes;
+
+    std::array<std::uint32_t, N + kTranslationRefs>    refs_{};
+    std::array<char, OriginalBytes + TranslationBytes> chars_{};
+
+    consteval std::uint32_t append(const std::size_t base, std::size_t& size, const std::string_view string) {
+        if (string.size() > kMaxPooledStringSize) { throw std::logic_error("BilingualPool: string too long."); }
+        const std::size_t offset = size;
+        for (const char c : string) { chars_[base + size++] = c; }
+        return pack_pooled_string(offset, string.size());
+    }
+};
+
+/// @brief Pool a constant table of bilingual strings, see BilingualPool.
+/// @tparam Table The table.
+/// @return The pool.
+template <const auto& Table>
+consteval auto make_bilingual_pool() {
+    constexpr bool shared = [] {
+        for (const BilingualView& entry : Table) {
+            if (entry.original != entry.translation) { return false; }
+        }
+        return true;
+    }();
+    constexpr auto bytes = [](const bool translations) {
+        std::size_t size = 0;
+        for (const BilingualView& entry : Table) { size += (translations ? entry.translation : entry.original).size(); }
+        return size;
+    };
+    constexpr std::size_t original_bytes    = bytes(false);
+    constexpr std::size_t translation_bytes = shared ? 0 : bytes(true);
+    static_assert(original_bytes <= kMaxStringPoolSize && translation_bytes <= kMaxStringPoolSize, "Pool too large.");
+    return BilingualPool<Table.size(), original_bytes, translation_bytes, shared>(Table);
+}
+
+}  // namespace faker
+
+#endif  // FAKER_STRING_POOL_H
@@ -0,0 +1,138 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file wildcard_pattern.cpp
+
+#include "wildcard_pattern.h"
+
+#include <array>
+#include <cstring>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "random_engine.h"
+#include "faker/internal/symbol_source.h"
+
+namespace faker {
+
+WildcardSymbols::WildcardSymbols(const std::string_view digits, const std::string_view letters) :
+    engine(get_random_engine()),
+    digits(digits),
+    letters(letters),
+    digits_source(make_symbol_source(digits.size())),
+    letters_source(make_symbol_source(letters.size())) {}
+
+std::size_t
+    WildcardPattern::expand(const std::span<char> out, const std::string_view digits, const std::string_view letters)
+        const {
+    if (slot_count_ == 0) {
+        std::memcpy(out.data(), literal_.data(), size_);
+        return size_;
+    }
+
+    WildcardSymbols symbols(digits, letters);
+    return expand(out, symbols);
+}
+
+std::size_t WildcardPattern::expand(const std::span<char> out, WildcardSymbols& symbols) const {
+    // A plain loop: GCC expands a variable-size memcpy here into `rep movsq`, which costs more than the whole
+    // short copy.
+    for (std::size_t i = 0; i < size_; ++i) { out[i] = literal_[i]; }
+
+    switch (check_digit_scheme_) {
+    case CheckDigitScheme::None: break;
+    case CheckDigitScheme::Luhn: return expand_with_check_digit<CheckDigitScheme::Luhn>(out, symbols);
+    case CheckDigitScheme::GS1 : return expand_with_check_digit<CheckDigitScheme::GS1>(out, symbols);
+    case CheckDigitScheme::UPCE: return expand_with_check_digit<CheckDigitScheme::UPCE>(out, symbols);
+    }
+
+    // Work on local copies: stores through `out` may alias anything reachable from `symbols`, which would keep the
+    // sources in memory instead of registers.
+    std::mt19937_64&       random_engine  = symbols.engine;
+    const std::string_view digits         = symbols.digits;
+    const std::string_view letters        = symbols.letters;
+    SymbolSource           digits_source  = symbols.digits_source;
+    SymbolSource           letters_source = symbols.letters_source;
+    for (std::size_t i = 0; i < slot_count_; ++i) {
+        const std::uint8_t slot = slots_[i];
+        out[slot & kPositionMask] = (slot & kLetterFlag) != 0 ? letters[letters_source(random_engine)]
+                                                              : digits[digits_source(random_engine)];
+    }
+    symbols.digits_source  = digits_source;
+    symbols.letters_source = letters_source;
+
+    return size_;
+}
+
+template <CheckDigitScheme Scheme>
+std::size_t WildcardPattern::expand_with_check_digit(const std::span<char> out, WildcardSymbols& symbols) const {
+    // The last slot is the check digit, every other slot is a digit slot.
+    std::mt19937_64&       random_engine  = symbols.engine;
+    const std::string_view digits         = symbols.digits;
+    SymbolSource           digits_source  = symbols.digits_source;
+    unsigned               checksum       = literal_checksum_;
+    const std::size_t      check_position = size_ - 1U;
+    for (std::size_t i = 0; i + 1 < slot_count_; ++i) {
+        const std::size_t position = slots_[i] & kPositionMask;
+        const char        digit    = digits[digits_source(random_engine)];
+        out[position]              = digit;
+        checksum += check_digit_weight(Scheme, static_cast<unsigned>(digit - '0'), check_position - position);
+    }
+    symbols.digits_source = digits_source;
+
+    if constexpr (Scheme == CheckDigitScheme::UPCE) {
+        out[check_position] = upce_check_digit({out.data(), check_position});
+    } else {
+        out[check_position] = static_cast<char>('0' + (10 - checksum % 10) % 10);
+    }
+
+    return size_;
+}
+
+std::string WildcardPattern::expand(const std::string_view digits, const std::string_view letters) const {
+    std::string out(size_, '\0');
+    expand(std::span<char>(out), digits, letters);
+    return out;
+}
+
+std::pair<std::string, std::string> expand_with_same_symbols(
+    const WildcardPattern& first,
+    const WildcardPattern& second,
+    const std::string_view digits,
+    const std::string_view letters
+) {
+    const std::size_t first_digit_count  = first.digit_count();
+    const std::size_t second_digit_count = second.digit_count();
+    if (first.slot_count() != second.slot_count() || first_digit_count != second_digit_count) {
+        return {first.expand(digits, letters), second.expand(digits, letters)};
+    }
+
+    std::string first_out(first.size(), '\0');
+    first.expand(std::span<char>(first_out), digits, letters);
+
+    // Gather the drawn symbols by kind, in order of appearance.
+    std::array<char, kMaxWildcardPatternSize> drawn_digits{};
+    std::array<char, kMaxWildcardPatternSize> drawn_letters{};
+    std::size_t                               digit_index  = 0;
+    std::size_t                               letter_index = 0;
+    for (std::size_t i = 0; i < first.slot_count(); ++i) {
+        const char symbol = first_out[first.slot_position(i)];
+        first.is_letter_slot(i) ? drawn_letters[letter_index++] = symbol : drawn_digits[digit_index++] = symbol;
+    }
+
+    std::string second_out(second.literal());
+    digit_index  = 0;
+    letter_index = 0;
+    for (std::size_t i = 0; i < second.slot_count(); ++i) {
+        second_out[second.slot_position(i)] =
+            second.is_letter_slot(i) ? drawn_letters[letter_index++] : drawn_digits[digit_index++];
+    }
+
+    return {std::move(first_out), std::move(second_out)};
+}
+
+}  // namespace faker
@@ -0,0 +1,299 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file wildcard_pattern.h
+
+#ifndef FAKER_WILDCARD_PATTERN_H
+#define FAKER_WILDCARD_PATTERN_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "check_digit.h"
+#include "faker/internal/symbol_source.h"
+#include "validation.h"
+
+namespace faker {
+
+/// @brief Maximum number of bytes a compiled wildcard pattern can expand to.
+inline constexpr std::size_t kMaxWildcardPatternSize = 128;
+
+/// @brief Default digits used to fill `#` slots.
+inline constexpr std::string_view kWildcardDigits = "0123456789";
+
+/// @brief Default letters used to fill `@` slots.
+inline constexpr std::string_view kWildcardLetters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+/// @brief Symbol lists and random state shared by a batch of expansions.
+///
+/// Leftover symbols of a random word are used by the next expansion instead of being dropped, so a batch of 12-digit
+/// barcodes costs two engine calls per three barcodes instead of one per barcode.
+struct WildcardSymbols {
+    /// @brief Create the shared state on the thread's random engine.
+    /// @param digits Digits list used for `#` slots.
+    /// @param letters Letters list used for `@` slots.
+    explicit WildcardSymbols(std::string_view digits = kWildcardDigits, std::string_view letters = kWildcardLetters);
+
+    std::mt19937_64& engine;
+    std::string_view digits;
+    std::string_view letters;
+    SymbolSource     digits_source;
+    SymbolSource     letters_source;
+};
+
+/// @brief A `#`/`@` template compiled once into its literal bytes and slot positions.
+///
+/// `#` marks a digit slot and `@` marks a letter slot, as in the data tables.
+/// Compiling strips `chars_to_remove` and records where each slot lives, so that an expansion is a copy of the
+/// literal bytes followed by one store per slot, instead of one scan of the template per wildcard kind.
+/// The class is a literal type: constexpr format tables can be compiled at compile time,
+/// see @code compile_wildcard_patterns()@endcode.
+class WildcardPattern {
+public:
+    constexpr WildcardPattern() = default;
+
+    /// @brief Compile a pattern.
+    /// @param pattern The template string.
+    /// @param chars_to_remove Characters dropped from the template, e.g. " -()".
+    constexpr explicit WildcardPattern(const std::string_view pattern, const std::string_view chars_to_remove = {}) {
+        append(pattern, chars_to_remove);
+    }
+
+    /// @brief Append a template piece, `#` and `@` become slots.
+    /// @param pattern The template string.
+    /// @param chars_to_remove Characters dropped from the template.
+    /// @return This pattern.
+    constexpr WildcardPattern& append(const std::string_view pattern, const std::string_view chars_to_remove = {}) {
+        for (const char c : pattern) {
+            if (chars_to_remove.find(c) != std::string_view::npos) { continue; }
+            if (c == '#') {
+                push_slot(false);
+            } else if (c == '@') {
+                push_slot(true);
+            } else {
+                push_literal(c);
+            }
+        }
+        return *this;
+    }
+
+    /// @brief Append a literal piece, `#` and `@` are kept as they are.
+    /// @param literal The literal string.
+    /// @param chars_to_remove Characters dropped from the literal.
+    /// @return This pattern.
+    constexpr WildcardPattern&
+        append_literal(const std::string_view literal, const std::string_view chars_to_remove = {}) {
+        for (const char c : literal) {
+            if (chars_to_remove.find(c) == std::string_view::npos) { push_literal(c); }
+        }
+        return *this;
+    }
+
+    /// @brief Append a template piece whose first "{}" placeholder is replaced with a literal.
+    /// @param pattern The template string.
+    /// @param replacement The literal replacing the placeholder.
+    /// @param chars_to_remove Characters dropped from both the template and the replacement.
+    /// @return This pattern.
+    constexpr WildcardPattern& append_placeholder(
+        const std::string_view pattern,
+        const std::string_view replacement,
+        const std::string_view chars_to_remove = {}
+    ) {
+        const std::size_t pos = pattern.find("{}");
+        if (pos == std::string_view::npos) { return append(pattern, chars_to_remove); }
+        append(pattern.substr(0, pos), chars_to_remove);
+        append_literal(replacement, chars_to_remove);
+        return append(pattern.substr(pos + 2), chars_to_remove);
+    }
+
+    /// @brief Turn the last character into a check digit over all the digits before it.
+    ///
+    /// The pattern must consist of digits and `#` slots only, and end with a `#` slot. The weights of the literal
+    /// digits are summed here, and each drawn digit is added to the sum while it is written, so the check digit is
+    /// ready as soon as the last random digit is. UPC-E weights depend on the last UPC-E digit, so its check digit
+    /// is computed from the written digits instead.
+    /// @param scheme The check digit scheme.
+    /// @return This pattern.
+    constexpr WildcardPattern& with_check_digit(const CheckDigitScheme scheme) {
+        check_digit_scheme_ = scheme;
+        literal_checksum_   = 0;
+        if (scheme == CheckDigitScheme::None) { return *this; }
+
+        if (slot_count_ == 0 || slot_position(slot_count_ - 1U) != size_ - 1U) {
+            throw_exception<std::invalid_argument>("Invalid pattern: a check digit pattern must end with '#'.");
+        }
+        for (std::size_t i = 0; i < size_; ++i) {
+            const char c = literal_[i];
+            if (c == '@' && is_slot(i)) {
+                throw_exception<std::invalid_argument>("Invalid pattern: a check digit pattern must not contain '@'.");
+            }
+            if (c == '#' && is_slot(i)) { continue; }
+            if (c < '0' || c > '9') {
+                throw_exception<std::invalid_argument>("Invalid pattern: a check digit pattern must only have digits.");
+            }
+            literal_checksum_ = static_cast<std::uint16_t>(
+                literal_checksum_ + check_digit_weight(scheme, static_cast<unsigned>(c - '0'), size_ - 1U - i)
+            );
+        }
+        return *this;
+    }
+
+    /// @brief The check digit scheme of the pattern.
+    [[nodiscard]] constexpr CheckDigitScheme check_digit_scheme() const {
+        return check_digit_scheme_;
+    }
+
+    /// @brief Number of bytes an expansion writes.
+    [[nodiscard]] constexpr std::size_t size() const {
+        return size_;
+    }
+
+    /// @brief Number of `#` and `@` slots.
+    [[nodiscard]] constexpr std::size_t slot_count() const {
+        return slot_count_;
+    }
+
+    /// @brief Number of `#` slots.
+    [[nodiscard]] constexpr std::size_t digit_count() const {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < slot_count_; ++i) {
+            if ((slots_[i] & kLetterFlag) == 0) { ++count; }
+        }
+        return count;
+    }
+
+    /// @brief The literal bytes, slots hold a '#' or '@' placeholder.
+    [[nodiscard]] constexpr std::string_view literal() const {
+        return {literal_.data(), size_};
+    }
+
+    /// @brief Position of the slot in the expanded string.
+    [[nodiscard]] constexpr std::size_t slot_position(const std::size_t index) const {
+        return static_cast<std::size_t>(slots_[index] & kPositionMask);
+    }
+
+    /// @brief Whether the slot is a `@` slot.
+    [[nodiscard]] constexpr bool is_letter_slot(const std::size_t index) const {
+        return (slots_[index] & kLetterFlag) != 0;
+    }
+
+    /// @brief Expand the pattern into a caller buffer.
+    ///
+    /// Patterns with a check digit need `digits` to only hold decimal digits.
+    /// @param out Output buffer, must hold at least `size()` bytes.
+    /// @param digits Digits list used for `#` slots.
+    /// @param letters Letters list used for `@` slots.
+    /// @return Number of bytes written.
+    std::size_t expand(
+        std::span<char>  out,
+        std::string_view digits  = kWildcardDigits,
+        std::string_view letters = kWildcardLetters
+    ) const;
+
+    /// @brief Expand the pattern into a caller buffer, drawing from shared symbols.
+    ///
+    /// Patterns with a check digit need the digits list to only hold decimal digits.
+    /// @param out Output buffer, must hold at least `size()` bytes.
+    /// @param symbols The shared symbols.
+    /// @return Number of bytes written.
+    std::size_t expand(std::span<char> out, WildcardSymbols& symbols) const;
+
+    /// @brief Expand the pattern into a new string.
+    /// @param digits Digits list used for `#` slots.
+    /// @param letters Letters list used for `@` slots.
+    /// @return The expanded string.
+    [[nodiscard]] std::string
+        expand(std::string_view digits = kWildcardDigits, std::string_view letters = kWildcardLetters) const;
+
+private:
+    static constexpr std::uint8_t kLetterFlag   = 0x80;
+    static constexpr std::uint8_t kPositionMask = 0x7F;
+
+    static_assert(kMaxWildcardPatternSize <= kPositionMask + 1, "Slot positions must fit in 7 bits.");
+
+    std::array<char, kMaxWildcardPatternSize>         literal_{};
+    std::array<std::uint8_t, kMaxWildcardPatternSize> slots_{};
+    std::uint8_t                                      size_               = 0;
+    std::uint8_t                                      slot_count_         = 0;
+    CheckDigitScheme                                  check_digit_scheme_ = CheckDigitScheme::None;
+    std::uint16_t                                     literal_checksum_   = 0;
+
+    constexpr bool is_slot(const std::size_t position) const {
+        for (std::size_t i = 0; i < slot_count_; ++i) {
+            if (slot_position(i) == position) { return true; }
+        }
+        return false;
+    }
+
+    template <CheckDigitScheme Scheme>
+    std::size_t expand_with_check_digit(std::span<char> out, WildcardSymbols& symbols) const;
+
+    constexpr void push_literal(const char c) {
+        if (size_ == kMaxWildcardPatternSize) {
+            throw_exception<std::length_error>(
+                "Invalid pattern: longer than " + std::to_string(kMaxWildcardPatternSize) + " bytes."
+            );
+        }
+        literal_[size_++] = c;
+    }
+
+    // The literal is pushed first, so that a pattern that is too long throws before its slot is recorded.
+    constexpr void push_slot(const bool is_letter) {
+        push_literal(is_letter ? '@' : '#');
+        slots_[slot_count_++] = static_cast<std::uint8_t>((size_ - 1) | (is_letter ? kLetterFlag : 0));
+    }
+};
+
+/// @brief Compile every pattern of a constexpr format table.
+/// @param patterns The format table.
+/// @param chars_to_remove Characters dropped from every pattern.
+/// @return The compiled patterns, in the same order.
+template <std::size_t N>
+constexpr std::array<WildcardPattern, N> compile_wildcard_patterns(
+    const std::array<std::string_view, N>& patterns,
+    const std::string_view                 chars_to_remove = {}
+) {
+    std::array<WildcardPattern, N> compiled{};
+    for (std::size_t i = 0; i < N; ++i) { compiled[i] = WildcardPattern(patterns[i], chars_to_remove); }
+    return compiled;
+}
+
+/// @brief Compile every pattern of a constexpr format table, with a check digit in the last slot.
+/// @param patterns The format table.
+/// @param scheme The check digit scheme.
+/// @return The compiled patterns, in the same order.
+template <std::size_t N>
+constexpr std::array<WildcardPattern, N>
+    compile_wildcard_patterns(const std::array<std::string_view, N>& patterns, const CheckDigitScheme scheme) {
+    std::array<WildcardPattern, N> compiled{};
+    for (std::size_t i = 0; i < N; ++i) { compiled[i] = WildcardPattern(patterns[i]).with_check_digit(scheme); }
+    return compiled;
+}
+
+/// @brief Expand two patterns with the same random symbols.
+///
+/// The n-th `#` of `second` gets the same digit as the n-th `#` of `first`, and likewise for `@`.
+/// If the patterns have different numbers of slots of either kind, they are expanded independently.
+/// @param first The first pattern.
+/// @param second The second pattern.
+/// @param digits Digits list used for `#` slots.
+/// @param letters Letters list used for `@` slots.
+/// @return A pair of expanded strings.
+std::pair<std::string, std::string> expand_with_same_symbols(
+    const WildcardPattern& first,
+    const WildcardPattern& second,
+    std::string_view       digits  = kWildcardDigits,
+    std::string_view       letters = kWildcardLetters
+);
+
+}  // namespace faker
+
+#endif  // FAKER_WILDCARD_PATTERN_H
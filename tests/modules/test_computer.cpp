@@ -33,3 +33,83 @@ TEST(ComputerTest, MacAddressValidFormat) {
     ASSERT_FALSE(mac.empty());
     ASSERT_TRUE(std::regex_match(mac, std::regex(R"(^([0-9a-fA-F]{2}:){5}[0-9a-fA-F]{2}$)")));
 }
+
+TEST(ComputerTest, IpAddressWithinCidr) {
+    for (int i = 0; i < 100; ++i) {
+        const auto ipv4 = ip_address("192.168.4.0/22");
+        ASSERT_TRUE(std::regex_match(ipv4, std::regex(R"(^192\.168\.[4-7]\.\d{1,3}$)"))) << ipv4;
+
+        const auto ipv6 = ip_address("2001:db8:1::/48");
+        ASSERT_TRUE(ipv6.starts_with("2001:0db8:0001:")) << ipv6;
+    }
+    ASSERT_EQ(ip_address("10.1.2.3/32"), "10.1.2.3");
+    ASSERT_EQ(ip_address("10.1.2.3/24").substr(0, 7), "10.1.2.");
+}
+
+TEST(ComputerTest, IpAddressInvalidCidr) {
+    ASSERT_THROW(ip_address("10.0.0.0"), std::invalid_argument);
+    ASSERT_THROW(ip_address("10.0.0.0/33"), std::invalid_argument);
+    ASSERT_THROW(ip_address("10.0.256.0/8"), std::invalid_argument);
+    ASSERT_THROW(ip_address("10.0.0/8"), std::invalid_argument);
+    ASSERT_THROW(ip_address("2001:db8::1::/64"), std::invalid_argument);
+    ASSERT_THROW(ip_address("2001:db8:0:0:0:0:0:0:1/64"), std::invalid_argument);
+    ASSERT_THROW(ip_address("10.0.0.0/8", IpAddressOptions::ExcludeReserved), std::invalid_argument);
+    ASSERT_THROW(ip_address("fe80::/10", IpAddressOptions::ExcludeReserved), std::invalid_argument);
+}
+
+TEST(ComputerTest, IpAddressExcludeReserved) {
+    const std::regex reserved(R"(^(0|10|127|(22[4-9]|23\d|24\d|25[0-5]))\..*|^192\.168\..*|^169\.254\..*)");
+    for (int i = 0; i < 1000; ++i) {
+        const auto ipv4 = ip_address(IpAddressType::IPv4, IpAddressOptions::ExcludeReserved);
+        ASSERT_FALSE(std::regex_match(ipv4, reserved)) << ipv4;
+    }
+
+    // The block is 172.0.0.0/11, its upper half 172.16.0.0/12 is reserved.
+    for (int i = 0; i < 100; ++i) {
+        const auto ipv4 = ip_address("172.16.0.0/11", IpAddressOptions::ExcludeReserved);
+        ASSERT_TRUE(std::regex_match(ipv4, std::regex(R"(^172\.([0-9]|1[0-5])\..*)"))) << ipv4;
+    }
+}
+
+TEST(ComputerTest, IpAddressCompressedIPv6) {
+    const std::regex compressed(R"(^[0-9a-f:]{2,39}$)");
+    for (int i = 0; i < 100; ++i) {
+        const auto ipv6 = ip_address("2001:db8::/96", IpAddressOptions::CompressIPv6);
+        ASSERT_TRUE(ipv6.starts_with("2001:db8::")) << ipv6;
+        ASSERT_TRUE(std::regex_match(ipv6, compressed)) << ipv6;
+    }
+    ASSERT_EQ(ip_address("::/128", IpAddressOptions::CompressIPv6), "::");
+    ASSERT_EQ(ip_address("::1/128", IpAddressOptions::CompressIPv6), "::1");
+    ASSERT_EQ(ip_address("2001:db8::1:0:0:1/128", IpAddressOptions::CompressIPv6), "2001:db8::1:0:0:1");
+    ASSERT_EQ(ip_address("2001:0:0:1:0:0:0:1/128", IpAddressOptions::CompressIPv6), "2001:0:0:1::1");
+    ASSERT_EQ(ip_address("1:0:1:1:1:1:1:1/128", IpAddressOptions::CompressIPv6), "1:0:1:1:1:1:1:1");
+    ASSERT_EQ(ip_address("fe80::/128"), "fe80:0000:0000:0000:0000:0000:0000:0000");
+}
+
+TEST(ComputerTest, IpAddressesBatch) {
+    std::array<char, 1024> buffer{};
+    const std::size_t      size = ip_addresses(buffer, 20, "10.0.0.0/8");
+    ASSERT_GT(size, 0U);
+
+    const std::string_view text(buffer.data(), size);
+    ASSERT_EQ(std::ranges::count(text, '\n'), 20);
+    ASSERT_TRUE(std::regex_match(std::string(text), std::regex(R"(^(10(\.\d{1,3}){3}\n){20}$)")));
+
+    // Stops at the last whole address that fits.
+    std::array<char, 20> small{};
+    const std::size_t    written = ip_addresses(small, 10, IpAddressType::IPv6);
+    ASSERT_EQ(written, 0U);
+    ASSERT_EQ(ip_addresses(small, 10, "1.2.3.4/32", IpAddressOptions::None, ','), 16U);
+}
+
+TEST(ComputerTest, MacAddressesBatch) {
+    std::array<char, 18 * 10 + 5> buffer{};
+    ASSERT_EQ(mac_addresses(buffer, 20), 18U * 10);
+    ASSERT_EQ(mac_addresses(buffer, 2, ','), 18U * 2);
+    ASSERT_EQ(mac_addresses(buffer, 10), 18U * 10);
+    for (std::size_t i = 0; i < 10; ++i) {
+        const std::string mac(buffer.data() + 18 * i, 17);
+        ASSERT_TRUE(std::regex_match(mac, std::regex(R"(^[0-9a-f][26ae](:[0-9a-f]{2}){5}$)"))) << mac;
+        ASSERT_EQ(buffer[18 * i + 17], '\n');
+    }
+}
@@ -3,3 +3,271 @@
 // See the LICENSE file in the project root for more information.
 
 /// @file test_datetime.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <regex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "faker/datetime.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+using datetime::DateRange;
+using datetime::TimeRange;
+
+static std::chrono::year_month_day parse_date(const std::string& value) {
+    return {
+        std::chrono::year(std::stoi(value.substr(0, 4))),
+        std::chrono::month(static_cast<unsigned>(std::stoi(value.substr(5, 2)))),
+        std::chrono::day(static_cast<unsigned>(std::stoi(value.substr(8, 2)))),
+    };
+}
+
+TEST(DatetimeTest, DateInRange) {
+    const DateRange range("2023-12-30", "2024-01-02");
+    ASSERT_EQ(range.day_count(), 4);
+    std::set<std::string> seen;
+    for (int i = 0; i < 200; ++i) {
+        const std::string value = datetime::date(range);
+        ASSERT_TRUE(std::regex_match(value, std::regex(R"(\d{4}-\d{2}-\d{2})"))) << value;
+        ASSERT_GE(value, "2023-12-30");
+        ASSERT_LE(value, "2024-01-02");
+        seen.insert(value);
+    }
+    // Both ends can be drawn.
+    ASSERT_EQ(seen.size(), 4U);
+}
+
+TEST(DatetimeTest, DateOnAllowedWeekdays) {
+    const DateRange range("2000-01-01", "2030-12-31", DaysOfWeek::Monday | DaysOfWeek::Saturday);
+    for (int i = 0; i < 500; ++i) {
+        const std::chrono::weekday weekday{std::chrono::sys_days(parse_date(datetime::date(range)))};
+        ASSERT_TRUE(weekday == std::chrono::Monday || weekday == std::chrono::Saturday);
+    }
+    ASSERT_EQ(datetime::date("2024-02-26", "2024-03-03", DaysOfWeek::Thursday), "2024-02-29");
+}
+
+TEST(DatetimeTest, DateUniformOverAllowedWeekdays) {
+    // March 2024 starts on a Friday: 5 Fridays, 5 Saturdays and 4 Mondays.
+    const DateRange range("2024-03-01", "2024-03-31", DaysOfWeek::Monday | DaysOfWeek::Friday | DaysOfWeek::Saturday);
+    ASSERT_EQ(range.allowed_day_count(), 14);
+
+    constexpr int              kDraws = 70000;
+    std::map<std::string, int> counts;
+    for (int i = 0; i < kDraws; ++i) { ++counts[datetime::date(range)]; }
+    ASSERT_EQ(counts.size(), 14U);
+    for (const auto& [value, count] : counts) { ASSERT_NEAR(count, kDraws / 14, 300) << value; }
+}
+
+TEST(DatetimeTest, InvalidDateRange) {
+    ASSERT_THROW(DateRange(""), std::invalid_argument);
+    ASSERT_THROW(DateRange("2023-01-01", "2022-12-31"), std::invalid_argument);
+    ASSERT_THROW(DateRange("2023-02-30", "2023-03-01"), std::invalid_argument);
+    ASSERT_THROW(DateRange("2023/01/01", "2023-03-01"), std::invalid_argument);
+    // 2024-03-04 to 2024-03-06 is Monday to Wednesday.
+    ASSERT_THROW(DateRange("2024-03-04", "2024-03-06", DaysOfWeek::Friday), std::invalid_argument);
+}
+
+TEST(DatetimeTest, TimeInRange) {
+    const TimeRange range("08:00:00", "08:00:02");
+    ASSERT_EQ(range.second_count(), 3);
+    std::set<std::string> seen;
+    for (int i = 0; i < 100; ++i) { seen.insert(datetime::time(range)); }
+    ASSERT_EQ(seen, (std::set<std::string>{"08:00:00", "08:00:01", "08:00:02"}));
+    ASSERT_THROW(TimeRange("09:00:00", "08:00:00"), std::invalid_argument);
+    ASSERT_THROW(TimeRange("25:00:00"), std::invalid_argument);
+}
+
+TEST(DatetimeTest, Datetime) {
+    const std::string value = datetime::datetime("2023-01-01", "2023-12-31", "08:00:00", "17:00:00");
+    ASSERT_TRUE(std::regex_match(value, std::regex(R"(2023-\d{2}-\d{2} (0[89]|1[0-7]):\d{2}:\d{2})"))) << value;
+    const DateRange leap_day("2024-02-29", "2024-02-29");
+    const TimeRange last_second("23:59:59", "23:59:59");
+    ASSERT_EQ(datetime::datetime(leap_day, last_second), "2024-02-29 23:59:59");
+}
+
+TEST(DatetimeTest, EpochValues) {
+    using namespace std::chrono;
+    const DateRange leap_day("2024-02-29", "2024-02-29");
+    const TimeRange last_second("23:59:59", "23:59:59");
+    ASSERT_EQ(datetime::date_point(leap_day), sys_days(2024y / February / 29));
+    ASSERT_EQ(datetime::time_of_day(last_second), 86'399s);
+    ASSERT_EQ(datetime::datetime_point(leap_day, last_second), sys_days(2024y / February / 29) + 86'399s);
+    const auto point = datetime::datetime_point_ns(leap_day, last_second);
+    ASSERT_EQ(floor<seconds>(point), sys_days(2024y / February / 29) + 86'399s);
+
+    // The numeric values are the ones the strings are formatted from.
+    const DateRange           mondays("2023-01-01", "2023-12-31", DaysOfWeek::Monday);
+    const TimeRange           office("08:00:00", "17:00:00");
+    std::vector<std::int64_t> values(1000);
+    datetime::fill_datetimes(values, mondays, office);
+    for (const std::int64_t value : values) {
+        const sys_seconds time{seconds(value)};
+        const sys_days    day = floor<days>(time);
+        ASSERT_EQ(weekday(day), Monday);
+        ASSERT_EQ(year_month_day(day).year(), 2023y);
+        ASSERT_GE(time - day, 8h);
+        ASSERT_LE(time - day, 17h);
+    }
+    datetime::fill_dates(values, mondays);
+    for (const std::int64_t value : values) { ASSERT_EQ(weekday(floor<days>(sys_seconds(seconds(value)))), Monday); }
+    datetime::fill_times(values, TimeRange("08:00:00", "08:00:02"));
+    ASSERT_EQ(std::set<std::int64_t>(values.begin(), values.end()), (std::set<std::int64_t>{28'800, 28'801, 28'802}));
+
+    std::set<std::int64_t> nanoseconds;
+    datetime::fill_datetimes_ns(values, leap_day, last_second);
+    for (const std::int64_t value : values) {
+        const sys_time<std::chrono::nanoseconds> time{std::chrono::nanoseconds(value)};
+        ASSERT_EQ(floor<seconds>(time), sys_days(2024y / February / 29) + 86'399s);
+        nanoseconds.insert(value);
+    }
+    ASSERT_GT(nanoseconds.size(), 990U);
+}
+
+TEST(DatetimeTest, NanosecondEpochRange) {
+    std::vector<std::int64_t> values(1);
+    const TimeRange           day;
+    ASSERT_NO_THROW(datetime::fill_datetimes_ns(values, DateRange("1677-09-22", "2262-04-10"), day));
+    const DateRange           too_early("1677-09-21", "2000-01-01");
+    ASSERT_THROW(datetime::fill_datetimes_ns(values, too_early, day), std::invalid_argument);
+    ASSERT_THROW(datetime::datetime_point_ns(DateRange("2000-01-01", "2262-04-11"), day), std::invalid_argument);
+    // Seconds fit for any year.
+    ASSERT_NO_THROW(datetime::fill_datetimes(values, DateRange("1000-01-01", "3000-12-31"), day));
+}
+
+TEST(DatetimeTest, EventTimesArePoisson) {
+    datetime::EventTimeOptions options;
+    options.events_per_second = 1000;
+    datetime::EventTimeSequence events(1'700'000'000'000'000'000, options);
+
+    constexpr int kEvents   = 100000;
+    std::int64_t  previous  = events.next_ns();
+    const auto    first     = previous;
+    double        sum_gaps  = 0;
+    double        sum_gaps2 = 0;
+    for (int i = 1; i < kEvents; ++i) {
+        const std::int64_t event = events.next_ns();
+        ASSERT_GE(event, previous);
+        const auto gap = static_cast<double>(event - previous);
+        sum_gaps += gap;
+        sum_gaps2 += gap * gap;
+        previous = event;
+    }
+    // Exponential gaps: mean 1 ms and standard deviation equal to the mean.
+    const double mean = sum_gaps / (kEvents - 1);
+    ASSERT_NEAR(mean, 1e6, 1e4);
+    ASSERT_NEAR(std::sqrt(sum_gaps2 / (kEvents - 1) - mean * mean), 1e6, 2e4);
+    ASSERT_GE(first, 1'700'000'000'000'000'000);
+}
+
+TEST(DatetimeTest, EventTimeChunksAreDeterministic) {
+    datetime::EventTimeOptions options;
+    options.events_per_second = 200;
+    options.process           = ArrivalProcess::Bursty;
+    options.chunk_nanoseconds = 100'000'000;
+
+    datetime::EventTimeSequence whole(0, options, 42);
+    std::vector<std::int64_t>   expected;
+    while (whole.chunk() < 3) { whole.next_ns(); }
+    while (whole.chunk() == 3) { expected.push_back(whole.next_ns()); }
+
+    datetime::EventTimeSequence chunk(0, options, 42, 3);
+    std::vector<std::int64_t>   actual;
+    while (chunk.chunk() == 3) { actual.push_back(chunk.next_ns()); }
+    ASSERT_EQ(actual, expected);
+    ASSERT_GE(expected.front(), 300'000'000);
+    ASSERT_LT(expected.back(), 400'000'000);
+
+    datetime::EventTimeSequence other_seed(0, options, 43, 3);
+    ASSERT_NE(other_seed.next_ns(), expected.front());
+}
+
+TEST(DatetimeTest, EventTimesFollowDiurnalCycle) {
+    datetime::EventTimeOptions options;
+    options.events_per_second = 1;
+    options.process           = ArrivalProcess::Diurnal;
+    options.diurnal_amplitude = 0.5;
+    options.diurnal_peak_hour = 14;
+    datetime::EventTimeSequence events(0, options);
+
+    // Ten days: the rate around 14:00 is three times the rate around 02:00.
+    std::array<int, 24> hours{};
+    for (std::int64_t event = events.next_ns(); event < 10 * 86'400'000'000'000; event = events.next_ns()) {
+        ++hours[static_cast<std::size_t>(event / 3'600'000'000'000 % 24)];
+    }
+    ASSERT_NEAR(hours[14] / static_cast<double>(hours[2]), 3.0, 0.5);
+    int total = 0;
+    for (const int count : hours) { total += count; }
+    ASSERT_NEAR(total, 864000, 5000);
+}
+
+TEST(DatetimeTest, BurstyEventTimesKeepMeanRate) {
+    datetime::EventTimeOptions options;
+    options.events_per_second = 100;
+    options.process           = ArrivalProcess::Bursty;
+    datetime::EventTimeSequence events(0, options, 7);
+
+    // 10000 seconds: the mean rate holds, and gaps vary far more than exponential gaps.
+    std::int64_t count     = 0;
+    std::int64_t previous  = events.next_ns();
+    double       sum_gaps  = 0;
+    double       sum_gaps2 = 0;
+    for (std::int64_t event = events.next_ns(); event < 10'000'000'000'000; event = events.next_ns()) {
+        const auto gap = static_cast<double>(event - previous);
+        sum_gaps += gap;
+        sum_gaps2 += gap * gap;
+        previous = event;
+        ++count;
+    }
+    ASSERT_NEAR(static_cast<double>(count), 1e6, 1e5);
+    const double mean = sum_gaps / static_cast<double>(count);
+    ASSERT_GT(std::sqrt(sum_gaps2 / static_cast<double>(count) - mean * mean) / mean, 1.2);
+}
+
+TEST(DatetimeTest, EventTimeOutputs) {
+    datetime::EventTimeSequence events(1'709'210'096'789'012'345);
+    const std::regex iso(R"(\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{3}Z)");
+    ASSERT_TRUE(std::regex_match(events.next_iso(), iso));
+    ASSERT_TRUE(std::regex_match(events.next_iso(9), std::regex(R"(2024-02-29T12:34:5\d\.\d{9}Z)")));
+    ASSERT_THROW(events.next_iso(10), std::invalid_argument);
+
+    datetime::EventTimeSequence copy = events;
+    std::array<std::int64_t, 4> ns{};
+    std::array<std::int64_t, 4> ms{};
+    copy.fill_ns(ns);
+    events.fill_ms(ms);
+    for (std::size_t i = 0; i < ns.size(); ++i) { ASSERT_EQ(ms[i], ns[i] / 1'000'000); }
+
+    // Each string is 24 bytes plus the delimiter, the third one does not fit.
+    std::string       buffer(60, '\0');
+    const std::size_t size = events.write_iso(buffer, 10);
+    ASSERT_EQ(size, 50U);
+    ASSERT_EQ(buffer[24], '\n');
+    ASSERT_TRUE(std::regex_match(buffer.substr(0, 24), iso));
+    ASSERT_EQ(events.write_iso(buffer, 0), 0U);
+}
+
+TEST(DatetimeTest, InvalidEventTimeOptions) {
+    datetime::EventTimeOptions options;
+    options.events_per_second = 0;
+    ASSERT_THROW(datetime::EventTimeSequence(0, options), std::invalid_argument);
+    options                   = {};
+    options.diurnal_amplitude = 1.5;
+    ASSERT_THROW(datetime::EventTimeSequence(0, options), std::invalid_argument);
+    options              = {};
+    options.burst_factor = 0.5;
+    ASSERT_THROW(datetime::EventTimeSequence(0, options), std::invalid_argument);
+    options                   = {};
+    options.chunk_nanoseconds = 0;
+    ASSERT_THROW(datetime::EventTimeSequence(0, options), std::invalid_argument);
+}
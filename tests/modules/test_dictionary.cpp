@@ -0,0 +1,81 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_dictionary.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "faker/business.h"
+#include "faker/dictionary.h"
+#include "faker/person.h"
+#include "faker/product.h"
+
+using namespace ::faker;
+using namespace faker::dictionary;
+
+static std::set<std::string_view> values_of(const Dictionary& dictionary) {
+    std::set<std::string_view> values;
+    for (std::size_t i = 0; i < dictionary.size(); ++i) { values.insert(dictionary[static_cast<TokenId>(i)]); }
+    return values;
+}
+
+TEST(DictionaryTest, HoldsTheValuesOfTheStringGenerators) {
+    const auto first_names = values_of(get(DictionaryFields::FirstName, Languages::Japanese, Genders::F));
+    const auto titles      = values_of(get(DictionaryFields::Title, Languages::English, Genders::M));
+    const auto industries  = values_of(get(DictionaryFields::Industry, Languages::SimplifiedChinese));
+    const auto colors      = values_of(get(DictionaryFields::Color, Languages::English));
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_TRUE(first_names.contains(person::first_name(Languages::Japanese, Genders::F).original()));
+        ASSERT_TRUE(titles.contains(person::title(Languages::English, Genders::M)));
+        ASSERT_TRUE(industries.contains(business::industry(Languages::SimplifiedChinese)));
+        ASSERT_TRUE(colors.contains(product::color()));
+    }
+
+    const auto last_names = get(DictionaryFields::LastName, Languages::SimplifiedChinese);
+    ASSERT_NE(last_names[0], last_names.translation(0));
+    const auto departments = get(DictionaryFields::Department);
+    ASSERT_EQ(departments[0], departments.translation(0));
+    ASSERT_EQ(get(DictionaryFields::Gender, Languages::English).size(), 2);
+}
+
+TEST(DictionaryTest, TokenIds) {
+    const std::size_t size = get(DictionaryFields::MaritalStatus).size();
+    std::set<TokenId> seen;
+    for (int i = 0; i < 200; ++i) {
+        const TokenId id = token_id(DictionaryFields::MaritalStatus);
+        ASSERT_LT(id, size);
+        seen.insert(id);
+    }
+    ASSERT_EQ(seen.size(), size);
+
+    std::array<TokenId, 10000> ids{};
+    fill_token_ids(ids, DictionaryFields::LastName, Languages::English);
+    const std::size_t last_names = get(DictionaryFields::LastName, Languages::English).size();
+    for (const TokenId id : ids) { ASSERT_LT(id, last_names); }
+    ASSERT_GT(std::set<TokenId>(ids.begin(), ids.end()).size(), last_names / 2);
+}
+
+TEST(DictionaryTest, NeedsASingleLanguageAndGender) {
+    ASSERT_THROW((void)get(DictionaryFields::Color, Languages::English | Languages::Japanese), std::invalid_argument);
+    ASSERT_THROW(
+        (void)token_id(DictionaryFields::FirstName, Languages::English, Genders::M | Genders::F),
+        std::invalid_argument
+    );
+}
+
+TEST(DictionaryTest, NeedsAKnownFieldAndLanguage) {
+    const auto             unknown_language = static_cast<Languages>(1 << 5);
+    const auto             unknown_field    = static_cast<DictionaryFields>(100);
+    std::array<TokenId, 4> ids{};
+    ASSERT_THROW((void)get(DictionaryFields::Color, unknown_language), std::invalid_argument);
+    ASSERT_THROW((void)token_id(DictionaryFields::LastName, unknown_language), std::invalid_argument);
+    ASSERT_THROW(fill_token_ids(ids, DictionaryFields::JobTitle, unknown_language), std::invalid_argument);
+    ASSERT_THROW(fill_token_ids(ids, unknown_field), std::invalid_argument);
+}
@@ -3,3 +3,35 @@
 // See the LICENSE file in the project root for more information.
 
 /// @file test_location.cpp
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "faker/location.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+using namespace faker::location;
+
+TEST(LocationTest, FieldsAreCorrelated) {
+    Location location(Regions::UnitedStates | Regions::UnitedKingdom | Regions::China | Regions::Japan);
+    for (int i = 0; i < 200; ++i) {
+        // The full address is read first half of the time, so it has to generate the fields it uses itself.
+        const std::string full_address = i % 2 == 0 ? location.full_address().original() : "";
+        const std::string postcode     = location.postcode();
+        const std::string line1        = location.address_line1().original();
+        const std::string line2        = location.address_line2().original();
+        ASSERT_EQ(location.postcode(), postcode);
+        ASSERT_EQ(location.address_line1().original(), line1);
+
+        const std::string address = location.full_address().original();
+        if (i % 2 == 0) { ASSERT_EQ(address, full_address); }
+        ASSERT_NE(address.find(line1), std::string::npos);
+        ASSERT_NE(address.find(line2), std::string::npos);
+        if (location.region() == "United States" || location.region() == "United Kingdom") {
+            ASSERT_NE(address.find(postcode), std::string::npos);
+        }
+        location.reroll();
+    }
+}
@@ -3,3 +3,208 @@
 // See the LICENSE file in the project root for more information.
 
 /// @file test_number.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <regex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "faker/number.h"
+
+using namespace ::testing;
+using namespace ::faker;
+using namespace faker::number;
+
+TEST(NumberTest, DecimalInRangeWithDecimalPlaces) {
+    for (int i = 0; i < 1000; ++i) {
+        const double value = decimal(-50.0, 50.0, 3);
+        ASSERT_GE(value, -50.0);
+        ASSERT_LE(value, 50.0);
+        ASSERT_NEAR(value * 1000, std::round(value * 1000), 1e-6) << value;
+    }
+    ASSERT_EQ(decimal(1.25, 1.25), 1.25);
+    ASSERT_EQ(decimal(2.0f, 2.0f, 0), 2.0f);
+}
+
+TEST(NumberTest, DecimalInvalidRange) {
+    ASSERT_THROW(decimal(1.001, 1.009), std::invalid_argument);
+    ASSERT_THROW(decimal(0.0, 1.0, -1), std::invalid_argument);
+    ASSERT_THROW(decimal(0.0, 1e10, 12), std::invalid_argument);
+}
+
+TEST(NumberTest, DecimalStringExactDecimalPlaces) {
+    const std::regex format(R"(^-?\d+\.\d{10}$)");
+    for (int i = 0; i < 1000; ++i) {
+        const std::string value = decimal_string(-100.0, 100.0, 10);
+        ASSERT_TRUE(std::regex_match(value, format)) << value;
+        ASSERT_LE(std::abs(std::stod(value)), 100.0);
+    }
+}
+
+TEST(NumberTest, DecimalStringLeadingZeros) {
+    ASSERT_EQ(decimal_string(0.05, 0.05), "0.05");
+    ASSERT_EQ(decimal_string(-0.05, -0.05), "-0.05");
+    ASSERT_EQ(decimal_string(-0.004, 0.004), "0.00");
+    ASSERT_EQ(decimal_string(-12.0, -12.0, 0), "-12");
+    ASSERT_EQ(decimal_string(1e-7, 1e-7, 7), "0.0000001");
+    ASSERT_EQ(decimal_string(123456.789, 123456.789, 3), "123456.789");
+}
+
+TEST(NumberTest, FillIntegersInRange) {
+    std::vector<int32_t> values(10000);
+    fill_integers(std::span(values), -5, 5);
+    std::array<int, 11> counts{};
+    for (const int32_t value : values) {
+        ASSERT_GE(value, -5);
+        ASSERT_LE(value, 5);
+        ++counts[static_cast<std::size_t>(value + 5)];
+    }
+    for (const int count : counts) { ASSERT_GT(count, 0); }
+
+    std::vector<int64_t> wide(1000);
+    fill_integers(std::span(wide), std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+    fill_integers(std::span(wide), std::numeric_limits<int64_t>::min() + 1, std::numeric_limits<int64_t>::max());
+    for (const int64_t value : wide) { ASSERT_NE(value, std::numeric_limits<int64_t>::min()); }
+
+    std::vector<int8_t> narrow(1000);
+    fill_integers(std::span(narrow), -128, 127);
+    fill_integers(std::span(narrow), 7, 7);
+    for (const int8_t value : narrow) { ASSERT_EQ(value, 7); }
+
+    ASSERT_THROW(fill_integers(std::span(values), 5, -5), std::invalid_argument);
+}
+
+TEST(NumberTest, FillUnsignedIntegersInRange) {
+    std::vector<uint16_t> values(10000);
+    fill_unsigned_integers(std::span(values), 1000, 32000);
+    for (const uint16_t value : values) {
+        ASSERT_GE(value, 1000);
+        ASSERT_LE(value, 32000);
+    }
+
+    std::vector<uint64_t> wide(1000);
+    fill_unsigned_integers(std::span(wide), 10, std::numeric_limits<uint64_t>::max() - 10);
+    for (const uint64_t value : wide) {
+        ASSERT_GE(value, 10U);
+        ASSERT_LE(value, std::numeric_limits<uint64_t>::max() - 10);
+    }
+
+    ASSERT_THROW(fill_unsigned_integers(std::span(values), 2, 1), std::invalid_argument);
+}
+
+TEST(NumberTest, FillDecimalsInRange) {
+    std::vector<double> values(10000);
+    fill_decimals(std::span(values), -50.0, 50.0, 3);
+    for (const double value : values) {
+        ASSERT_GE(value, -50.0);
+        ASSERT_LE(value, 50.0);
+        ASSERT_NEAR(value * 1000, std::round(value * 1000), 1e-6) << value;
+    }
+
+    std::vector<float> floats(100);
+    fill_decimals(std::span(floats), 1.5f, 1.5f, 1);
+    for (const float value : floats) { ASSERT_EQ(value, 1.5f); }
+
+    ASSERT_THROW(fill_decimals(std::span(values), 1.001, 1.009), std::invalid_argument);
+}
+
+TEST(NumberTest, FillDecimalsRejectsWhatDecimalRejects) {
+    std::vector<double> values(4);
+    ASSERT_THROW((void)decimal(0.0, 1000.0, -2), std::invalid_argument);
+    ASSERT_THROW(fill_decimals(std::span(values), 0.0, 1000.0, -2), std::invalid_argument);
+    ASSERT_THROW((void)decimal(2.0, 1.0), std::invalid_argument);
+    ASSERT_THROW(fill_decimals(std::span(values), 2.0, 1.0), std::invalid_argument);
+    ASSERT_THROW((void)decimal(0.0, 1e10, 12), std::invalid_argument);
+    ASSERT_THROW(fill_decimals(std::span(values), 0.0, 1e10, 12), std::invalid_argument);
+}
+
+TEST(NumberTest, FillRealsInRange) {
+    std::vector<double> values(10000);
+    fill_reals(std::span(values), -1.0, 1.0);
+    double sum = 0;
+    for (const double value : values) {
+        ASSERT_GE(value, -1.0);
+        ASSERT_LE(value, 1.0);
+        sum += value;
+    }
+    ASSERT_NEAR(sum / static_cast<double>(values.size()), 0.0, 0.05);
+
+    ASSERT_THROW(fill_reals(std::span(values), 1.0, 0.0), std::invalid_argument);
+}
+
+TEST(NumberTest, NormalAndLognormal) {
+    std::vector<double> values(100000);
+    fill_normal(std::span(values), 170.0, 10.0);
+    double sum = 0;
+    for (const double value : values) { sum += value; }
+    ASSERT_NEAR(sum / static_cast<double>(values.size()), 170.0, 0.2);
+
+    std::vector<float> positives(1000);
+    fill_lognormal(std::span(positives), 3.0f, 0.5f);
+    for (const float value : positives) { ASSERT_GT(value, 0.0f); }
+    ASSERT_GT(lognormal(), 0.0);
+    ASSERT_TRUE(std::isfinite(normal()));
+
+    ASSERT_THROW(normal(0.0, 0.0), std::invalid_argument);
+    ASSERT_THROW(fill_lognormal(std::span(values), 0.0, -1.0), std::invalid_argument);
+}
+
+TEST(NumberTest, ExponentialAndPareto) {
+    std::vector<double> values(100000);
+    fill_exponential(std::span(values), 0.05);
+    double sum = 0;
+    for (const double value : values) {
+        ASSERT_GE(value, 0.0);
+        sum += value;
+    }
+    ASSERT_NEAR(sum / static_cast<double>(values.size()), 20.0, 0.3);
+
+    fill_pareto(std::span(values), 1000.0, 3.0);
+    sum = 0;
+    for (const double value : values) {
+        ASSERT_GE(value, 1000.0);
+        sum += value;
+    }
+    // The mean is scale * shape / (shape - 1).
+    ASSERT_NEAR(sum / static_cast<double>(values.size()), 1500.0, 20.0);
+    ASSERT_GE(pareto(2.0f, 1.0f), 2.0f);
+
+    ASSERT_THROW(exponential(0.0), std::invalid_argument);
+    ASSERT_THROW(pareto(0.0, 1.0), std::invalid_argument);
+    ASSERT_THROW(fill_pareto(std::span(values), 1.0, std::nan("")), std::invalid_argument);
+}
+
+TEST(NumberTest, DistributionErrorNamesSampler) {
+    try {
+        pareto(1.0, -1.0);
+        FAIL();
+    } catch (const std::invalid_argument& error) {
+        const std::string message = error.what();
+        ASSERT_NE(message.find("pareto"), std::string::npos) << message;
+        ASSERT_NE(message.find("'shape'"), std::string::npos) << message;
+    }
+}
+
+TEST(NumberTest, Zipf) {
+    std::vector<uint64_t> ranks(100000);
+    fill_zipf(std::span(ranks), 1000, 1.0);
+    std::size_t first = 0;
+    for (const uint64_t rank : ranks) {
+        ASSERT_GE(rank, 1U);
+        ASSERT_LE(rank, 1000U);
+        if (rank == 1) { ++first; }
+    }
+    // P(1) = 1 / H(1000) = 0.1336.
+    ASSERT_NEAR(static_cast<double>(first) / static_cast<double>(ranks.size()), 0.1336, 0.005);
+    ASSERT_EQ(zipf(1), 1U);
+
+    ASSERT_THROW(zipf(0), std::invalid_argument);
+    ASSERT_THROW(fill_zipf(std::span(ranks), 10, 0.0), std::invalid_argument);
+}
@@ -3,3 +3,47 @@
 // See the LICENSE file in the project root for more information.
 
 /// @file test_payment.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include "faker/payment.h"
+
+using namespace ::faker;
+using namespace faker::payment;
+
+TEST(PaymentTest, CardNumberPassesLuhnCheck) {
+    constexpr auto kCardTypes = std::to_array<CardTypes>({
+        CardTypes::AmericanExpress,
+        CardTypes::JCB,
+        CardTypes::MasterCard,
+        CardTypes::UnionPay,
+        CardTypes::Visa,
+    });
+    for (const auto card_types : kCardTypes) {
+        for (int i = 0; i < 100; ++i) { ASSERT_TRUE(is_valid_card_number(card_number(card_types))); }
+    }
+}
+
+TEST(PaymentTest, ValidateCardNumbers) {
+    std::string records;
+    for (int i = 0; i < 100; ++i) { records += card_number() + '\n'; }
+    records += "4111111111111112\n";
+
+    std::array<bool, 101> results{};
+    ASSERT_EQ(validate_card_numbers(records, results), 101);
+    for (std::size_t i = 0; i < 100; ++i) { ASSERT_TRUE(results[i]); }
+    ASSERT_FALSE(results[100]);
+}
+
+TEST(PaymentTest, CardDate) {
+    std::set<std::string> seen;
+    for (int i = 0; i < 200; ++i) { seen.insert(payment::card_date("11/24", "02/25")); }
+    ASSERT_EQ(seen, (std::set<std::string>{"11/24", "12/24", "01/25", "02/25"}));
+    ASSERT_THROW(payment::card_date("02/25", "01/25"), std::invalid_argument);
+    ASSERT_THROW(payment::card_date("13/25", "01/26"), std::invalid_argument);
+}
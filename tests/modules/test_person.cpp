@@ -3,3 +3,106 @@
 // See the LICENSE file in the project root for more information.
 
 /// @file test_person.cpp
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "faker/person.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+using namespace faker::person;
+
+TEST(PersonTest, GeneratesRequestedFields) {
+    Person person(
+        Genders::M | Genders::F,
+        Languages::English,
+        Regions::UnitedStates,
+        "example.com",
+        ',',
+        PersonFields::Email | PersonFields::PhoneNumber
+    );
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_FALSE(person.phone_number().empty());
+        ASSERT_TRUE(person.email().ends_with("@example.com"));
+        // The full name the email is made from is generated too.
+        const std::string first_name = person.first_name().original();
+        ASSERT_EQ(person.full_name().original(), first_name + " " + person.last_name().original());
+        std::string user_name = first_name;
+        std::erase_if(user_name, [](const char c) { return c == ' ' || c == '-'; });
+        ASSERT_NE(person.email().find(user_name), std::string::npos);
+        ASSERT_THROW((void)person.gender(), std::logic_error);
+        ASSERT_THROW((void)person.job_title(), std::logic_error);
+        person.reroll();
+    }
+}
+
+TEST(PersonTest, TitleAgreesWithMaritalStatus) {
+    Person person(Genders::F, Languages::English, Regions::UnitedStates, "example.com", ',', PersonFields::Title);
+    for (int i = 0; i < 100; ++i) {
+        if (person.marital_status() == "single") { ASSERT_NE(person.title(), "Mrs."); }
+        ASSERT_THROW((void)person.full_name(), std::logic_error);
+        person.reroll();
+    }
+}
+
+// An ASCII user name, '@' and one of the domains.
+static bool is_generated_email(const std::string_view email, const std::set<std::string_view>& domains) {
+    const std::size_t at = email.find('@');
+    if (at == 0 || at == std::string_view::npos || !domains.contains(email.substr(at + 1))) { return false; }
+    return std::ranges::all_of(email.substr(0, at), [](const char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '.';
+    });
+}
+
+TEST(PersonTest, Email) {
+    constexpr Languages kAllLanguages =
+        Languages::English | Languages::SimplifiedChinese | Languages::TraditionalChinese | Languages::Japanese;
+    const std::set<std::string_view> domains = {"qq.com", "163.com"};
+    for (int i = 0; i < 500; ++i) {
+        ASSERT_TRUE(is_generated_email(email(kAllLanguages, " qq.com,, 163.com "), domains));
+        const std::string lowercase = email(kAllLanguages, "QQ.com", ',', true);
+        ASSERT_TRUE(std::ranges::none_of(lowercase, [](const char c) { return c >= 'A' && c <= 'Z'; }));
+    }
+    ASSERT_THROW((void)email(Languages::English, ""), std::invalid_argument);
+    ASSERT_THROW((void)email(Languages::English, " , "), std::invalid_argument);
+}
+
+TEST(PersonTest, EmailDomains) {
+    const std::set<std::string_view> domains = {"gmail.com"};
+    for (int i = 0; i < 100; ++i) {
+        const Person person(Genders::M, Languages::English, Regions::UnitedStates, "gmail.com, ", ',');
+        ASSERT_TRUE(is_generated_email(person.email(), domains)) << person.email();
+    }
+    ASSERT_THROW(Person(Genders::M, Languages::English, Regions::UnitedStates, ","), std::invalid_argument);
+    ASSERT_THROW(Person(Genders::M, Languages::English, Regions::UnitedStates, ""), std::invalid_argument);
+}
+
+TEST(PersonTest, Emails) {
+    const std::set<std::string_view> domains = {"gmail.com", "hotmail.com"};
+    std::array<char, 4096>           buffer{};
+    const std::size_t                size = emails(buffer, 1000, Languages::Japanese);
+    ASSERT_GT(size, 0);
+    ASSERT_LE(size, buffer.size());
+    ASSERT_EQ(buffer[size - 1], '\n');
+
+    std::size_t      count = 0;
+    std::string_view rest(buffer.data(), size);
+    while (!rest.empty()) {
+        const std::size_t end = rest.find('\n');
+        ASSERT_TRUE(is_generated_email(rest.substr(0, end), domains));
+        rest.remove_prefix(end + 1);
+        ++count;
+    }
+    ASSERT_LT(count, 1000);
+
+    const std::size_t written = emails(buffer, 10, Languages::English, "example.com", ',', true, ';');
+    ASSERT_EQ(std::count(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(written), ';'), 10);
+}
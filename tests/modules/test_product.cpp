@@ -3,3 +3,63 @@
 // See the LICENSE file in the project root for more information.
 
 /// @file test_product.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include "check_digit.h"
+#include "faker/product.h"
+
+using namespace ::faker;
+using namespace faker::product;
+
+TEST(ProductTest, BarcodeHasValidCheckDigit) {
+    for (int i = 0; i < 100; ++i) {
+        const std::string ean13 = barcode(BarcodeTypes::EAN13);
+        ASSERT_EQ(ean13.size(), 13);
+        ASSERT_EQ(ean13.back(), gs1_check_digit(std::string_view(ean13).substr(0, 12)));
+    }
+}
+
+TEST(ProductTest, BarcodeHasValidCheckDigitForAllTypes) {
+    for (int i = 0; i < 100; ++i) {
+        const std::string ean8 = barcode(BarcodeTypes::EAN8);
+        ASSERT_EQ(ean8.size(), 8);
+        ASSERT_EQ(ean8.back(), gs1_check_digit(std::string_view(ean8).substr(0, 7)));
+
+        const std::string upca = barcode(BarcodeTypes::UPCA);
+        ASSERT_EQ(upca.size(), 12);
+        ASSERT_EQ(upca.back(), gs1_check_digit(std::string_view(upca).substr(0, 11)));
+
+        const std::string upce = barcode(BarcodeTypes::UPCE);
+        ASSERT_EQ(upce.size(), 8);
+        ASSERT_TRUE(upce.front() == '0' || upce.front() == '1');
+        ASSERT_EQ(upce.back(), upce_check_digit(std::string_view(upce).substr(0, 7)));
+
+        const std::string isbn = barcode(BarcodeTypes::ISBN);
+        ASSERT_EQ(isbn.size(), 13);
+        ASSERT_TRUE(isbn.starts_with("978") || isbn.starts_with("979"));
+        ASSERT_EQ(isbn.back(), gs1_check_digit(std::string_view(isbn).substr(0, 12)));
+    }
+}
+
+TEST(ProductTest, Barcodes) {
+    std::array<char, 14 * 100> buffer{};
+    ASSERT_EQ(barcodes(buffer, 100), buffer.size());
+
+    const std::string_view records(buffer.data(), buffer.size());
+    for (std::size_t offset = 0; offset < records.size(); offset += 14) {
+        const std::string_view ean13 = records.substr(offset, 13);
+        ASSERT_EQ(records[offset + 13], '\n');
+        ASSERT_EQ(ean13.back(), gs1_check_digit(ean13.substr(0, 12)));
+    }
+}
+
+TEST(ProductTest, BarcodesStopsAtBufferEnd) {
+    std::array<char, 30> buffer{};
+    ASSERT_EQ(barcodes(buffer, 10, BarcodeTypes::EAN8, ','), 27);
+    ASSERT_EQ(buffer[26], ',');
+}
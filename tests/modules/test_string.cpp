@@ -4,3 +4,211 @@
 
 /// @file test_string.cpp
 
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "faker/string.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+using namespace faker::string;
+
+TEST(StringTest, UuidV4) {
+    const std::regex pattern(R"(^[0-9a-f]{8}-[0-9a-f]{4}-4[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}$)");
+    ASSERT_TRUE(std::regex_match(uuid(), pattern));
+
+    const auto id_without_hyphens = uuid(false);
+    ASSERT_TRUE(std::regex_match(id_without_hyphens, std::regex(R"(^[0-9a-f]{12}4[0-9a-f]{3}[89ab][0-9a-f]{15}$)")));
+}
+
+TEST(StringTest, UuidV7IsStrictlyIncreasing) {
+    const std::regex pattern(R"(^[0-9a-f]{8}-[0-9a-f]{4}-7[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}$)");
+
+    std::string previous = uuid(true, UuidVersion::V7);
+    for (int i = 0; i < 10000; ++i) {
+        std::string current = uuid(true, UuidVersion::V7);
+        ASSERT_TRUE(std::regex_match(current, pattern));
+        ASSERT_LT(previous, current);
+        previous = std::move(current);
+    }
+}
+
+TEST(StringTest, UuidBatch) {
+    std::vector<char> buffer(37 * 100 + 36);
+    ASSERT_EQ(uuid_batch(buffer, 1000), 37U * 100);
+    ASSERT_EQ(uuid_batch(buffer, 10), 37U * 10);
+
+    const std::regex pattern(R"(^[0-9a-f]{8}-[0-9a-f]{4}-4[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}$)");
+    for (std::size_t offset = 0; offset < 37 * 100; offset += 37) {
+        ASSERT_TRUE(std::regex_match(std::string(buffer.data() + offset, 36), pattern));
+        ASSERT_EQ(buffer[offset + 36], '\n');
+    }
+}
+
+TEST(StringTest, UuidBatchV7IsStrictlyIncreasing) {
+    std::vector<char> buffer(33 * 5000);
+    ASSERT_EQ(uuid_batch(buffer, 5000, false, UuidVersion::V7, ','), buffer.size());
+
+    const std::string_view records(buffer.data(), buffer.size());
+    for (std::size_t offset = 33; offset < records.size(); offset += 33) {
+        ASSERT_EQ(records[offset - 1], ',');
+        ASSERT_EQ(records[offset + 12], '7');
+        ASSERT_LT(records.substr(offset - 33, 32), records.substr(offset, 32));
+    }
+}
+
+TEST(StringTest, TextLength) {
+    for (int i = 0; i < 100; ++i) {
+        const std::string value = text(100, 200);
+        ASSERT_GE(value.size(), 100U);
+        ASSERT_LE(value.size(), 200U);
+    }
+    ASSERT_EQ(text(100000, 100000).size(), 100000U);
+    ASSERT_THROW(text(200, 100), std::invalid_argument);
+}
+
+TEST(StringTest, TextViewIsSliceOfText) {
+    for (int i = 0; i < 100; ++i) {
+        const std::string_view value = text_view(20000, 40000);
+        ASSERT_GE(value.size(), 20000U);
+        ASSERT_LE(value.size(), 40000U);
+        ASSERT_NE(value.back(), '\0');
+    }
+
+    // Views point into the same static corpus.
+    const std::string_view first  = text_view(10, 10);
+    const std::string_view second = text_view(10, 10);
+    ASSERT_LT(std::abs(first.data() - second.data()), 100000);
+
+    ASSERT_GE(text_view(40000, 1000000).size(), 40000U);
+    ASSERT_THROW(text_view(1000000, 1000000), std::invalid_argument);
+}
+
+TEST(StringTest, WriteTextToBuffer) {
+    std::vector<char> buffer(200000, '\0');
+    ASSERT_EQ(write_text(buffer), buffer.size());
+    ASSERT_EQ(std::ranges::count(buffer, '\0'), 0);
+
+    // The text repeats with the corpus, so it has long runs of words.
+    const std::string_view text(buffer.data(), buffer.size());
+    ASSERT_NE(text.find(" the "), std::string_view::npos);
+}
+
+TEST(StringTest, WriteTextToStream) {
+    std::ostringstream out;
+    write_text(out, 123456);
+    ASSERT_EQ(out.str().size(), 123456U);
+
+    std::ostringstream empty;
+    write_text(empty, 0);
+    ASSERT_TRUE(empty.str().empty());
+}
+
+TEST(StringTest, TextEndsWithWholeWord) {
+    for (int i = 0; i < 200; ++i) {
+        const std::string_view value = text_view(100, 200);
+        ASSERT_GE(value.size(), 100U);
+        ASSERT_LE(value.size(), 200U);
+        ASSERT_NE(value.back(), ' ');
+        // The corpus continues with a space after a whole word.
+        ASSERT_EQ(value.data()[value.size()], ' ') << value;
+    }
+    for (int i = 0; i < 200; ++i) {
+        const std::string value = text(10000, 100000);
+        ASSERT_NE(value.back(), ' ');
+    }
+}
+
+TEST(StringTest, TextShorterThanWordKeepsUtf8) {
+    for (int i = 0; i < 200; ++i) {
+        const std::string value = text(1, 3);
+        ASSERT_GE(value.size(), 1U);
+        ASSERT_LE(value.size(), 3U);
+        ASSERT_NE(static_cast<unsigned char>(value.back()) & 0xC0, 0xC0) << value;
+    }
+}
+
+TEST(StringTest, Words) {
+    ASSERT_TRUE(words(0).empty());
+    for (std::size_t count = 1; count < 50; ++count) {
+        const std::string value = words(count);
+        ASSERT_NE(value.front(), ' ');
+        ASSERT_NE(value.back(), ' ');
+
+        std::size_t word_count = 0;
+        for (std::size_t i = 0; i < value.size(); ++i) {
+            if (value[i] != ' ' && (i + 1 == value.size() || value[i + 1] == ' ')) { ++word_count; }
+        }
+        ASSERT_EQ(word_count, count) << value;
+    }
+    ASSERT_GT(words(100000).size(), 100000U);
+}
+
+TEST(StringTest, Sentences) {
+    ASSERT_TRUE(sentences(0).empty());
+    const std::regex sentence_end(R"([.!?]['")]?$)");
+    for (int i = 0; i < 100; ++i) {
+        const std::string value = sentences(2);
+        ASSERT_TRUE(std::regex_search(value, sentence_end)) << value;
+        ASSERT_NE(value.front(), ' ');
+    }
+}
+
+TEST(StringTest, MarkovText) {
+    ASSERT_TRUE(markov_text(0).empty());
+    for (unsigned int order = 1; order <= 3; ++order) {
+        for (std::size_t count = 1; count < 50; ++count) {
+            const std::string value = markov_text(count, order);
+            ASSERT_EQ(std::ranges::count(value, ' '), static_cast<std::ptrdiff_t>(count - 1)) << value;
+            ASSERT_EQ(value.find("  "), std::string::npos) << value;
+        }
+    }
+    ASSERT_NE(markov_text(10000, 1, 0.5), markov_text(10000, 1, 0.5));
+    ASSERT_THROW(markov_text(1, 0), std::invalid_argument);
+    ASSERT_THROW(markov_text(1, 4), std::invalid_argument);
+    ASSERT_THROW(markov_text(1, 2, -0.1), std::invalid_argument);
+    ASSERT_THROW(markov_text(1, 2, 1.5), std::invalid_argument);
+}
+
+TEST(StringTest, MarkovTextWordsFollowCorpus) {
+    const auto split = [](const std::string& value) {
+        std::vector<std::string> tokens;
+        std::istringstream       stream(value);
+        for (std::string token; stream >> token;) { tokens.push_back(token); }
+        return tokens;
+    };
+
+    // More words than the corpus has, so the run covers every word pair of the cyclic corpus.
+    const std::vector<std::string>                corpus = split(words(20000));
+    std::set<std::pair<std::string, std::string>> corpus_pairs;
+    for (std::size_t i = 0; i + 1 < corpus.size(); ++i) { corpus_pairs.emplace(corpus[i], corpus[i + 1]); }
+
+    // With no randomness, every word pair of the text is a word pair of the corpus.
+    const std::vector<std::string> text = split(markov_text(1000, 1));
+    for (std::size_t i = 0; i + 1 < text.size(); ++i) {
+        ASSERT_TRUE(corpus_pairs.contains({text[i], text[i + 1]})) << text[i] << ' ' << text[i + 1];
+    }
+}
+
+TEST(StringTest, WriteMarkovText) {
+    std::vector<char> buffer(1 << 16);
+    const std::size_t size = write_markov_text(buffer, 1, 0.2);
+    ASSERT_LE(size, buffer.size());
+    ASSERT_GT(size, buffer.size() - 64);
+    ASSERT_EQ(buffer[size - 1], ' ');
+    ASSERT_NE(buffer[0], ' ');
+    ASSERT_EQ(std::string_view(buffer.data(), size).find("  "), std::string_view::npos);
+    ASSERT_EQ(write_markov_text(std::span<char>(buffer.data(), 1)), 0U);
+}
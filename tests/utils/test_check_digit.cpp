@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_check_digit.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include "check_digit.h"
+#include "wildcard_pattern.h"
+
+using namespace ::faker;
+
+TEST(LuhnTest, CheckDigit) {
+    static_assert(luhn_check_digit("7992739871") == '3');
+    ASSERT_EQ(luhn_check_digit("411111111111111"), '1');
+    ASSERT_EQ(luhn_check_digit("37828224631000"), '5');
+}
+
+TEST(LuhnTest, IsValid) {
+    static_assert(is_luhn_valid("79927398713"));
+    ASSERT_TRUE(is_luhn_valid("4111111111111111"));
+    ASSERT_FALSE(is_luhn_valid("4111111111111112"));
+    ASSERT_FALSE(is_luhn_valid("4111 1111 1111 1111"));
+    ASSERT_FALSE(is_luhn_valid("0"));
+    ASSERT_FALSE(is_luhn_valid(""));
+}
+
+TEST(LuhnTest, ValidateRecords) {
+    const std::string records = "4111111111111111\n4111111111111112\n378282246310005\n"
+                                "1234567890123456789012345678901234567897\n41111111111111a1\n79927398713";
+    std::array<bool, 8> results{};
+
+    ASSERT_EQ(validate_luhn_records(records, results, '\n'), 6);
+    ASSERT_TRUE(results[0]);
+    ASSERT_FALSE(results[1]);
+    ASSERT_TRUE(results[2]);
+    ASSERT_EQ(results[3], is_luhn_valid("1234567890123456789012345678901234567897"));
+    ASSERT_FALSE(results[4]);
+    ASSERT_TRUE(results[5]);
+}
+
+TEST(LuhnTest, ValidateRecordsStopsAtResultsSize) {
+    const std::string   records = "4111111111111111,4111111111111111,4111111111111111";
+    std::array<bool, 2> results{};
+    ASSERT_EQ(validate_luhn_records(records, results, ','), 2);
+}
+
+TEST(LuhnTest, WildcardPatternWithCheckDigit) {
+    constexpr auto kPattern = WildcardPattern("4###############").with_check_digit(CheckDigitScheme::Luhn);
+    static_assert(kPattern.check_digit_scheme() == CheckDigitScheme::Luhn);
+    for (int i = 0; i < 1000; ++i) {
+        const std::string number = kPattern.expand();
+        ASSERT_EQ(number.size(), 16);
+        ASSERT_EQ(number.front(), '4');
+        ASSERT_TRUE(is_luhn_valid(number));
+    }
+}
+
+TEST(LuhnTest, WildcardPatternWithCheckDigitDigits) {
+    constexpr auto kPattern = WildcardPattern("4###############").with_check_digit(CheckDigitScheme::Luhn);
+    for (int i = 0; i < 1000; ++i) {
+        const std::string number = kPattern.expand("789");
+        ASSERT_EQ(number.substr(1, 14).find_first_not_of("789"), std::string::npos);
+        ASSERT_TRUE(is_luhn_valid(number));
+    }
+}
+
+TEST(GS1Test, CheckDigit) {
+    static_assert(gs1_check_digit("400638133393") == '1');
+    ASSERT_EQ(gs1_check_digit("978030640615"), '7');
+    ASSERT_EQ(gs1_check_digit("03600029145"), '2');
+    ASSERT_EQ(gs1_check_digit("9638507"), '4');
+}
+
+TEST(UPCETest, CheckDigit) {
+    static_assert(upce_check_digit("0425261") == '4');
+    ASSERT_EQ(upce_check_digit("0123450"), gs1_check_digit("01200000345"));
+    ASSERT_EQ(upce_check_digit("0123453"), gs1_check_digit("01230000045"));
+    ASSERT_EQ(upce_check_digit("0123404"), gs1_check_digit("01234000000"));
+    ASSERT_EQ(upce_check_digit("0123457"), gs1_check_digit("01234500007"));
+}
+
+TEST(GS1Test, WildcardPatternWithCheckDigit) {
+    constexpr auto kPattern = WildcardPattern("978##########").with_check_digit(CheckDigitScheme::GS1);
+    for (int i = 0; i < 1000; ++i) {
+        const std::string number = kPattern.expand();
+        ASSERT_EQ(number.size(), 13);
+        ASSERT_EQ(number.back(), gs1_check_digit(std::string_view(number).substr(0, 12)));
+    }
+}
+
+TEST(LuhnTest, WildcardPatternWithCheckDigitInvalid) {
+    ASSERT_THROW(WildcardPattern("4###A").with_check_digit(CheckDigitScheme::Luhn), std::invalid_argument);
+    ASSERT_THROW(WildcardPattern("4##@#").with_check_digit(CheckDigitScheme::Luhn), std::invalid_argument);
+    ASSERT_THROW(WildcardPattern("4####0").with_check_digit(CheckDigitScheme::Luhn), std::invalid_argument);
+}
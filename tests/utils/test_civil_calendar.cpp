@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_civil_calendar.cpp
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include "civil_calendar.h"
+
+using namespace ::faker;
+
+TEST(CivilCalendarTest, MatchesChrono) {
+    // Every day from 1600-01-01 to 2400-12-31, through two 400-year eras and the negative day counts.
+    const std::int64_t first = std::chrono::sys_days(std::chrono::year(1600) / 1 / 1).time_since_epoch().count();
+    const std::int64_t last  = std::chrono::sys_days(std::chrono::year(2400) / 12 / 31).time_since_epoch().count();
+    for (std::int64_t days = first; days <= last; ++days) {
+        const std::chrono::sys_days       sys_days{std::chrono::days(days)};
+        const std::chrono::year_month_day expected{sys_days};
+        const CivilDate                   civil = civil_from_days(days);
+        ASSERT_EQ(civil.year, static_cast<int>(expected.year()));
+        ASSERT_EQ(civil.month, static_cast<unsigned>(expected.month()));
+        ASSERT_EQ(civil.day, static_cast<unsigned>(expected.day()));
+        ASSERT_EQ(days_from_civil(civil.year, civil.month, civil.day), days);
+        ASSERT_EQ(weekday_from_days(days), std::chrono::weekday(sys_days).c_encoding());
+    }
+}
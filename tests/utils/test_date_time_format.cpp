@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_date_time_format.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "civil_calendar.h"
+#include "date_time_format.h"
+
+using namespace ::faker;
+
+// 2024-02-29T12:34:56.789012345, a Thursday.
+constexpr DateTimeValue kLeapDay = {19782, 45296, 789012345};
+
+TEST(DateTimeFormatTest, CommonFormats) {
+    ASSERT_EQ(DateTimeFormat("%Y-%m-%d").format(kLeapDay), "2024-02-29");
+    ASSERT_EQ(DateTimeFormat("%H:%M:%S").format(kLeapDay), "12:34:56");
+    ASSERT_EQ(DateTimeFormat("%m/%y").format(kLeapDay), "02/24");
+    ASSERT_EQ(DateTimeFormat("%FT%TZ").format(kLeapDay), "2024-02-29T12:34:56Z");
+    ASSERT_EQ(DateTimeFormat("%Y-%m-%dT%H:%M:%S.%3fZ").format(kLeapDay), "2024-02-29T12:34:56.789Z");
+    ASSERT_EQ(DateTimeFormat("%T.%f").format(kLeapDay), "12:34:56.789012");
+    ASSERT_EQ(DateTimeFormat("%9f|%1f").format(kLeapDay), "789012345|7");
+    ASSERT_EQ(DateTimeFormat("%R 100%%").format(kLeapDay), "12:34 100%");
+    ASSERT_EQ(DateTimeFormat("plain").format(kLeapDay), "plain");
+    ASSERT_EQ(DateTimeFormat("%Y").format({days_from_civil(12345, 6, 7), 0, 0}), "12345");
+    ASSERT_EQ(DateTimeFormat("%Y-%m-%d").format({days_from_civil(7, 1, 2), 0, 0}), "0007-01-02");
+    ASSERT_FALSE(DateTimeFormat("%FT%T.%6f").has_generic_fields());
+}
+
+TEST(DateTimeFormatTest, GenericFieldsUseStrftime) {
+    // The tests run in the "C" locale.
+    const std::array<std::pair<const char*, const char*>, 4> cases = {{
+        {"%a %b %e %j", "Thu Feb 29 060"},
+        {"%A, %B %-d", "Thursday, February 29"},
+        {"%u %w %I %p", "4 4 12 PM"},
+        {"%D %c", "02/29/24 Thu Feb 29 12:34:56 2024"},
+    }};
+    for (const auto& [format, expected] : cases) {
+        const DateTimeFormat compiled(format);
+        ASSERT_TRUE(compiled.has_generic_fields());
+        ASSERT_EQ(compiled.format(kLeapDay), expected) << format;
+    }
+    ASSERT_EQ(DateTimeFormat("trailing %").format(kLeapDay), "trailing %");
+}
+
+TEST(DateTimeFormatTest, WriteFitsMaxSize) {
+    const DateTimeFormat format("%Y-%m-%dT%H:%M:%S.%9f");
+    std::string          buffer(format.max_size(), '\0');
+    const std::size_t    size = format.write(buffer.data(), {days_from_civil(-12345, 1, 1), 86399, 999999999});
+    ASSERT_LE(size, format.max_size());
+    ASSERT_EQ(buffer.substr(0, size), "-12345-01-01T23:59:59.999999999");
+}
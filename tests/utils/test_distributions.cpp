@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_distributions.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "distributions.h"
+
+using namespace ::faker;
+
+constexpr int kDraws = 200000;
+
+TEST(DistributionsTest, StandardNormalMoments) {
+    std::mt19937_64 engine(42);
+    double          sum         = 0;
+    double          sum_squares = 0;
+    int             beyond_tail = 0;
+    int             within_one  = 0;
+    for (int i = 0; i < kDraws; ++i) {
+        const double x = standard_normal(engine);
+        sum += x;
+        sum_squares += x * x;
+        if (std::abs(x) > 3.442619855899) { ++beyond_tail; }
+        if (std::abs(x) < 1) { ++within_one; }
+    }
+    ASSERT_NEAR(sum / kDraws, 0.0, 0.01);
+    ASSERT_NEAR(sum_squares / kDraws, 1.0, 0.02);
+    // P(|x| < 1) = 0.6827, P(|x| > 3.4426) = 0.000576.
+    ASSERT_NEAR(within_one / static_cast<double>(kDraws), 0.6827, 0.005);
+    ASSERT_GT(beyond_tail, 60);
+    ASSERT_LT(beyond_tail, 180);
+}
+
+TEST(DistributionsTest, StandardExponentialMoments) {
+    std::mt19937_64 engine(42);
+    double          sum         = 0;
+    double          sum_squares = 0;
+    int             below_one   = 0;
+    for (int i = 0; i < kDraws; ++i) {
+        const double x = standard_exponential(engine);
+        ASSERT_GE(x, 0.0);
+        sum += x;
+        sum_squares += x * x;
+        if (x < 1) { ++below_one; }
+    }
+    ASSERT_NEAR(sum / kDraws, 1.0, 0.01);
+    ASSERT_NEAR(sum_squares / kDraws, 2.0, 0.05);
+    // P(x < 1) = 1 - 1/e.
+    ASSERT_NEAR(below_one / static_cast<double>(kDraws), 1 - std::exp(-1.0), 0.005);
+}
+
+TEST(DistributionsTest, ZipfMatchesProbabilities) {
+    constexpr std::size_t kRanks = 10;
+    for (const double exponent : {0.5, 1.0, 2.0}) {
+        std::mt19937_64             engine(42);
+        const ZipfSampler           sampler(kRanks, exponent);
+        std::array<int, kRanks + 1> counts{};
+        for (int i = 0; i < kDraws; ++i) {
+            const std::uint64_t rank = sampler(engine);
+            ASSERT_GE(rank, 1U);
+            ASSERT_LE(rank, kRanks);
+            ++counts[rank];
+        }
+
+        double normalizer = 0;
+        for (std::size_t k = 1; k <= kRanks; ++k) { normalizer += std::pow(static_cast<double>(k), -exponent); }
+        for (std::size_t k = 1; k <= kRanks; ++k) {
+            const double expected = std::pow(static_cast<double>(k), -exponent) / normalizer;
+            ASSERT_NEAR(counts[k] / static_cast<double>(kDraws), expected, 0.005) << exponent << " " << k;
+        }
+    }
+}
+
+TEST(DistributionsTest, ZipfSingleRankAndLargeCount) {
+    std::mt19937_64   engine(42);
+    const ZipfSampler single(1, 1.5);
+    for (int i = 0; i < 100; ++i) { ASSERT_EQ(single(engine), 1U); }
+
+    const ZipfSampler large(std::uint64_t{1} << 40, 1.0);
+    for (int i = 0; i < 1000; ++i) {
+        const std::uint64_t rank = large(engine);
+        ASSERT_GE(rank, 1U);
+        ASSERT_LE(rank, std::uint64_t{1} << 40);
+    }
+}
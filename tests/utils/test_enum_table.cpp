@@ -0,0 +1,41 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_enum_table.cpp
+
+#include <gtest/gtest.h>
+
+#include <string_view>
+
+#include "enum_table.h"
+#include "faker/types/enums.h"
+
+using namespace ::faker;
+
+enum class Sequential { First, Second, Third };
+
+TEST(EnumTableTest, Index) {
+    static_assert(enum_index(Languages::English) == 0);
+    static_assert(enum_index(Languages::Japanese) == 3);
+    static_assert(enum_index(CardTypes::Visa) == 4);
+    static_assert(enum_index(Sequential::Third) == 2);
+}
+
+TEST(EnumTableTest, Lookup) {
+    constexpr EnumTable<Sequential, int, 3> kPartial = {{Sequential::Third, 3}, {Sequential::First, 1}};
+    static_assert(kPartial[Sequential::Third] == 3);
+    static_assert(!kPartial.is_complete());
+    ASSERT_TRUE(kPartial.contains(Sequential::First));
+    ASSERT_FALSE(kPartial.contains(Sequential::Second));
+    ASSERT_EQ(kPartial[Sequential::First], 1);
+
+    constexpr EnumTable<Languages, EnumTable<Genders, std::string_view, 2>, 2> kNested = {
+        {Languages::English, {{Genders::M, "Male"}, {Genders::F, "Female"}}},
+        {Languages::SimplifiedChinese, {{Genders::M, "男"}}},
+    };
+    static_assert(kNested[Languages::English][Genders::F] == "Female");
+    // A nested table with a missing value makes the whole table incomplete.
+    static_assert(!kNested.is_complete());
+    ASSERT_EQ(kNested[Languages::SimplifiedChinese][Genders::M], "男");
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_markov_chain.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "markov_chain.h"
+
+using namespace ::faker;
+
+TEST(MarkovChainTest, BuildsOneStatePerDistinctContext) {
+    // Cyclic sequence 0 1 0 2 0 1: contexts of order 1 are {0, 1, 2}, of order 2 {01, 10, 02, 20}.
+    const std::vector<std::uint32_t> tokens = {0, 1, 0, 2, 0, 1};
+
+    const MarkovChain first_order(tokens, 1);
+    ASSERT_EQ(first_order.state_count(), 3U);
+    ASSERT_EQ(first_order.position_count(), tokens.size());
+    // 0 -> 1, 0 -> 2, 1 -> 0, 2 -> 0.
+    ASSERT_EQ(first_order.edge_count(), 4U);
+
+    const MarkovChain second_order(tokens, 2);
+    ASSERT_EQ(second_order.state_count(), 4U);
+    ASSERT_EQ(second_order.state_at(0), second_order.state_at(4));
+}
+
+TEST(MarkovChainTest, StepsFollowTrainingCounts) {
+    // After 0 comes 1 three times and 2 once, 1 and 2 are always followed by 0.
+    const std::vector<std::uint32_t> tokens = {0, 1, 0, 1, 0, 1, 0, 2};
+    const MarkovChain                chain(tokens, 1);
+    const std::uint32_t              zero = chain.state_at(0);
+
+    constexpr int      kSteps = 100000;
+    std::mt19937_64    engine(42);
+    std::array<int, 3> counts{};
+    for (int i = 0; i < kSteps; ++i) {
+        const MarkovChain::Step step = chain.next(zero, engine());
+        ++counts[step.token];
+        ASSERT_EQ(chain.next(step.state, engine()).token, 0U);
+    }
+    ASSERT_EQ(counts[0], 0);
+    ASSERT_NEAR(counts[1] / static_cast<double>(kSteps), 0.75, 0.01);
+    ASSERT_NEAR(counts[2] / static_cast<double>(kSteps), 0.25, 0.01);
+}
+
+TEST(MarkovChainTest, InvalidArguments) {
+    const std::vector<std::uint32_t> tokens = {0, 1};
+    ASSERT_THROW(MarkovChain(tokens, 0), std::invalid_argument);
+    ASSERT_THROW(MarkovChain(tokens, 3), std::invalid_argument);
+    ASSERT_THROW(MarkovChain(std::vector<std::uint32_t>{1U << 21}, 1), std::invalid_argument);
+}
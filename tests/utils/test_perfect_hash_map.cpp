@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_perfect_hash_map.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "perfect_hash_map.h"
+
+using namespace ::faker;
+
+// Keys "000" to "299", each mapped to its number.
+static constexpr auto kNumberedKeys = [] {
+    std::array<std::array<char, 3>, 300> keys{};
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        keys[i][0] = static_cast<char>('0' + i / 100);
+        keys[i][1] = static_cast<char>('0' + i / 10 % 10);
+        keys[i][2] = static_cast<char>('0' + i % 10);
+    }
+    return keys;
+}();
+
+static constexpr auto kNumberedEntries = [] {
+    std::array<std::pair<std::string_view, int>, kNumberedKeys.size()> entries{};
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        entries[i] = {std::string_view(kNumberedKeys[i].data(), 3), static_cast<int>(i)};
+    }
+    return entries;
+}();
+
+TEST(PerfectHashMapTest, Find) {
+    constexpr PerfectHashMap kPorts(
+        std::to_array<std::pair<std::string_view, int>>({{"http", 80}, {"https", 443}, {"ssh", 22}})
+    );
+    static_assert(*kPorts.find("https") == 443);
+    static_assert(kPorts.find("ftp") == nullptr);
+    const int* ssh = kPorts.find(std::string("ssh"));
+    ASSERT_NE(ssh, nullptr);
+    ASSERT_EQ(*ssh, 22);
+    ASSERT_EQ(kPorts.find(""), nullptr);
+    ASSERT_EQ(kPorts.find("http "), nullptr);
+}
+
+TEST(PerfectHashMapTest, EveryKeyHasItsSlot) {
+    constexpr PerfectHashMap kNumbers(kNumberedEntries);
+    static_assert(kNumbers.size() == 300);
+    for (int i = 0; i < 1000; ++i) {
+        const std::string key   = std::to_string(1000 + i).substr(1);
+        const int*        value = kNumbers.find(key);
+        if (i < 300) {
+            ASSERT_NE(value, nullptr) << key;
+            ASSERT_EQ(*value, i);
+        } else {
+            ASSERT_EQ(value, nullptr) << key;
+        }
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_string_pool.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "faker/types/bilingual.h"
+#include "person_data.h"
+#include "string_pool.h"
+
+using namespace ::faker;
+
+static constexpr auto kNames =
+    std::to_array<BilingualView>({{"张伟", "Zhang Wei"}, {"", ""}, {"王芳", "Wang Fang"}});
+static constexpr auto kNamePool = make_bilingual_pool<kNames>();
+
+static constexpr auto kWords    = std::to_array<BilingualView>({{"alpha", "alpha"}, {"beta", "beta"}});
+static constexpr auto kWordPool = make_bilingual_pool<kWords>();
+
+TEST(StringPoolTest, PackedString) {
+    constexpr char kChars[] = "abcdef";
+    EXPECT_EQ(pooled_string(kChars, pack_pooled_string(2, 3)), "cde");
+    EXPECT_EQ(pooled_string(kChars, pack_pooled_string(0, 0)), "");
+    EXPECT_EQ(pack_pooled_string(kMaxStringPoolSize - 1, kMaxPooledStringSize), 0xFFFFFFFF);
+}
+
+TEST(StringPoolTest, BilingualPool) {
+    static_assert(kNamePool.size() == 3);
+    static_assert(kNamePool.translation(2) == "Wang Fang");
+    for (std::size_t i = 0; i < kNames.size(); ++i) {
+        EXPECT_EQ(kNamePool.original(i), kNames[i].original);
+        EXPECT_EQ(kNamePool.translation(i), kNames[i].translation);
+    }
+    EXPECT_NE(kNamePool.original_chars(), kNamePool.translation_chars());
+}
+
+TEST(StringPoolTest, SharedTranslations) {
+    // One reference per entry, and the 9 bytes of "alphabeta" padded to 12.
+    static_assert(sizeof(kWordPool) == sizeof(std::uint32_t) * kWords.size() + 12);
+    EXPECT_EQ(kWordPool.original_chars(), kWordPool.translation_chars());
+    for (std::size_t i = 0; i < kWords.size(); ++i) {
+        EXPECT_EQ(kWordPool.original_refs()[i], kWordPool.translation_refs()[i]);
+        EXPECT_EQ(kWordPool[i].translation, kWords[i].translation);
+    }
+}
+
+TEST(StringPoolTest, MatchesDataTables) {
+    using namespace ::faker::person;
+    static_assert(sizeof(kEnglishLastNamePool) < sizeof(kEnglishLastNames) / 2);
+    for (std::size_t i = 0; i < kEnglishLastNames.size(); ++i) {
+        EXPECT_EQ(kEnglishLastNamePool[i].original, kEnglishLastNames[i].original);
+    }
+    for (std::size_t i = 0; i < kJapaneseFemaleFirstNames.size(); ++i) {
+        EXPECT_EQ(kJapaneseFemaleFirstNamePool[i].original, kJapaneseFemaleFirstNames[i].original);
+        EXPECT_EQ(kJapaneseFemaleFirstNamePool[i].translation, kJapaneseFemaleFirstNames[i].translation);
+    }
+}
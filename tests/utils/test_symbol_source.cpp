@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_symbol_source.cpp
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <random>
+
+#include "faker/internal/symbol_source.h"
+
+using namespace ::faker;
+
+TEST(SymbolSourceTest, SymbolsPerWord) {
+    static_assert(SymbolSource(10).symbols_per_word() == 18);
+    static_assert(SymbolSource(26).symbols_per_word() == 12);
+    static_assert(SymbolSource(52).symbols_per_word() == 10);
+    static_assert(SymbolSource(16).symbols_per_word() == 15);
+    static_assert(SymbolSource(2).symbols_per_word() == 60);
+}
+
+TEST(SymbolSourceTest, MultiplyHigh) {
+    ASSERT_EQ(multiply_high(0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL), 0xFFFFFFFFFFFFFFFEULL);
+    ASSERT_EQ(multiply_high(std::uint64_t{1} << 63, 10), 5);
+    ASSERT_EQ(multiply_high(12345, 67890), 0);
+}
+
+TEST(SymbolSourceTest, SingleSymbol) {
+    std::mt19937_64 engine(42);
+    SymbolSource    source(1);
+    for (int i = 0; i < 200; ++i) { ASSERT_EQ(source(engine), 0); }
+}
+
+TEST(SymbolSourceTest, InRangeAndRoughlyUniform) {
+    constexpr std::size_t kAlphabetSize = 10;
+    constexpr int         kDraws        = 100000;
+
+    std::mt19937_64                engine(42);
+    SymbolSource                   source(kAlphabetSize);
+    std::array<int, kAlphabetSize> counts{};
+    for (int i = 0; i < kDraws; ++i) {
+        const std::size_t symbol = source(engine);
+        ASSERT_LT(symbol, kAlphabetSize);
+        ++counts[symbol];
+    }
+
+    // Each bucket expects 10000 draws with a standard deviation of about 95.
+    for (const int count : counts) {
+        ASSERT_GT(count, 9500);
+        ASSERT_LT(count, 10500);
+    }
+}
+
+TEST(SymbolSourceTest, OneWordPerGroup) {
+    std::mt19937_64 engine(42);
+    std::mt19937_64 reference(42);
+    SymbolSource    source(16);
+
+    // A power-of-two alphabet never rejects, so 15 hex digits consume exactly one word.
+    for (std::size_t i = 0; i < source.symbols_per_word(); ++i) { source(engine); }
+    reference.discard(1);
+    ASSERT_EQ(engine(), reference());
+}
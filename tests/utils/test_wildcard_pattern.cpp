@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Shizhongqi
+// Licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+/// @file test_wildcard_pattern.cpp
+
+#include <gtest/gtest.h>
+
+#include <regex>
+#include <string>
+#include <string_view>
+
+#include "wildcard_pattern.h"
+
+using namespace ::faker;
+
+TEST(WildcardPatternTest, CompileAtCompileTime) {
+    constexpr WildcardPattern pattern("(20) #### @@", " ()");
+    static_assert(pattern.size() == 8);
+    static_assert(pattern.slot_count() == 6);
+    static_assert(pattern.digit_count() == 4);
+    static_assert(pattern.literal() == "20####@@");
+    ASSERT_EQ(2, pattern.slot_position(0));
+    ASSERT_FALSE(pattern.is_letter_slot(0));
+    ASSERT_TRUE(pattern.is_letter_slot(5));
+}
+
+TEST(WildcardPatternTest, ExpandDigitsAndLetters) {
+    const WildcardPattern pattern("Unit @##-#");
+    const std::string     expanded = pattern.expand("123", "XY");
+    ASSERT_TRUE(std::regex_match(expanded, std::regex(R"(^Unit [XY][123]{2}-[123]$)")));
+}
+
+TEST(WildcardPatternTest, ExpandIntoBuffer) {
+    const WildcardPattern pattern("4###");
+    char                  buffer[8] = {};
+    ASSERT_EQ(4, pattern.expand(std::span<char>(buffer)));
+    ASSERT_TRUE(std::regex_match(std::string(buffer, 4), std::regex(R"(^4\d{3}$)")));
+}
+
+TEST(WildcardPatternTest, NoWildcard) {
+    ASSERT_EQ("Hello", WildcardPattern("Hello").expand());
+}
+
+TEST(WildcardPatternTest, AppendPlaceholderKeepsReplacementLiteral) {
+    WildcardPattern pattern;
+    pattern.append_placeholder("{}_##", "a#b @c", " ");
+    ASSERT_EQ("a#b@c_##", pattern.literal());
+    ASSERT_EQ(2, pattern.slot_count());
+    ASSERT_TRUE(std::regex_match(pattern.expand(), std::regex(R"(^a#b@c_\d{2}$)")));
+}
+
+TEST(WildcardPatternTest, CompileTable) {
+    constexpr auto patterns = compile_wildcard_patterns(std::to_array<std::string_view>({"1#", "2-##"}), "-");
+    static_assert(patterns[0].size() == 2);
+    static_assert(patterns[1].literal() == "2##");
+}
+
+TEST(WildcardPatternTest, PatternTooLong) {
+    ASSERT_THROW(WildcardPattern(std::string(kMaxWildcardPatternSize + 1, '#')), std::length_error);
+}
+
+TEST(ExpandWithSameSymbolsTest, SameDigitsAndLetters) {
+    const auto [fst, snd] = expand_with_same_symbols(WildcardPattern("##号@"), WildcardPattern("No. ## @"));
+    ASSERT_EQ(fst.substr(0, 2), snd.substr(4, 2));
+    ASSERT_EQ(fst.back(), snd.back());
+}
+
+TEST(ExpandWithSameSymbolsTest, DifferentSlotCounts) {
+    const auto [fst, snd] = expand_with_same_symbols(WildcardPattern("##"), WildcardPattern("#"));
+    ASSERT_EQ(2, fst.size());
+    ASSERT_EQ(1, snd.size());
+}